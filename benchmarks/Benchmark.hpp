@@ -0,0 +1,70 @@
+#ifndef __SIMPLE_REFLECT_BENCHMARK_HEADER__
+#define __SIMPLE_REFLECT_BENCHMARK_HEADER__
+
+// Small helpers shared by the benchmark programs, not part of the library.
+
+#include <chrono>
+#include <cstdio>
+#include <vector>
+#include <cstdint>
+#include <algorithm>
+
+namespace bench
+{
+
+// Keep the compiler from optimizing value (or the computation of it) away.
+template<typename T>
+inline void do_not_optimize(const T& value)
+{
+#if defined(__GNUC__) || defined(__clang__)
+	asm volatile("" : : "r,m"(value) : "memory");
+#else
+	static volatile const T* sink;
+	sink = &value;
+#endif
+}
+
+inline double seconds_since(std::chrono::steady_clock::time_point start)
+{ return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count(); }
+
+// Runs func, which performs ops operations, repeats times. Returns the best time in ns per operation.
+template<typename Func>
+double ns_per_op(std::size_t ops, Func&& func, int repeats = 5)
+{
+	double best = 1e300;
+	for (int i = 0; i < repeats; ++i)
+	{
+		const auto start = std::chrono::steady_clock::now();
+		func();
+		best = std::min(best, seconds_since(start) * 1e9 / static_cast<double>(ops));
+	}
+	return best;
+}
+
+// p in [0, 1], sorts samples
+inline double percentile(std::vector<double>& samples, double p)
+{
+	std::sort(samples.begin(), samples.end());
+	return samples[static_cast<std::size_t>(p * static_cast<double>(samples.size() - 1))];
+}
+
+// xorshift64, the same sequence on every platform
+struct Random
+{
+	std::uint64_t state = 0x9E3779B97F4A7C15ull;
+
+	std::uint64_t operator()() noexcept
+	{
+		state ^= state << 13;
+		state ^= state >> 7;
+		state ^= state << 17;
+		return state;
+	}
+};
+
+inline void row(const char* name, double value, const char* unit)
+{ std::printf("  %-44s %10.2f %s\n", name, value, unit); }
+
+} // namespace bench
+
+#endif //! __SIMPLE_REFLECT_BENCHMARK_HEADER__
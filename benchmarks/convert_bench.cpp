@@ -0,0 +1,188 @@
+// Reflect::convert against handwritten member-by-member copies.
+// Conversions are in functions that can not be inlined into the loop, so the loop
+// measures the generated copy code and not what the optimizer makes of the loop.
+
+#include <string>
+#include <vector>
+
+#include "SimpleReflect/Convert.hpp"
+#include "Benchmark.hpp"
+
+#if defined(__GNUC__) && !defined(__clang__)
+#define BENCH_NOINLINE [[gnu::noipa]]
+#elif defined(__clang__)
+#define BENCH_NOINLINE [[gnu::noinline]]
+#else
+#define BENCH_NOINLINE __declspec(noinline)
+#endif
+
+struct Quote
+{
+	std::int64_t ts;
+	double px;
+	std::int32_t bid_qty;
+	std::int32_t ask_qty;
+
+	REFLECT_DEFINE(Quote) {
+		REFLECT_MEMBER(ts),
+		REFLECT_MEMBER(px),
+		REFLECT_MEMBER(bid_qty),
+		REFLECT_MEMBER(ask_qty)
+	};
+};
+
+// same members and layout
+struct QuoteCopy
+{
+	std::int64_t ts;
+	double px;
+	std::int32_t bid_qty;
+	std::int32_t ask_qty;
+
+	REFLECT_DEFINE(QuoteCopy) {
+		REFLECT_MEMBER(ts),
+		REFLECT_MEMBER(px),
+		REFLECT_MEMBER(bid_qty),
+		REFLECT_MEMBER(ask_qty)
+	};
+};
+
+// same members, different order
+struct QuoteReordered
+{
+	double px;
+	std::int32_t ask_qty;
+	std::int32_t bid_qty;
+	std::int64_t ts;
+
+	REFLECT_DEFINE(QuoteReordered) {
+		REFLECT_MEMBER(px),
+		REFLECT_MEMBER(ask_qty),
+		REFLECT_MEMBER(bid_qty),
+		REFLECT_MEMBER(ts)
+	};
+};
+
+struct Account
+{
+	std::string id;
+	std::int32_t level;
+
+	REFLECT_DEFINE(Account) {
+		REFLECT_MEMBER(id),
+		REFLECT_MEMBER(level)
+	};
+};
+
+struct AccountDto
+{
+	std::int64_t level;
+	std::string id;
+
+	REFLECT_DEFINE(AccountDto) {
+		REFLECT_MEMBER(level),
+		REFLECT_MEMBER(id)
+	};
+};
+
+struct Order
+{
+	std::int64_t id;
+	std::string symbol;
+	double price;
+	std::int32_t limits[3];
+	std::vector<std::int32_t> fills;
+	Account account;
+
+	REFLECT_DEFINE(Order) {
+		REFLECT_MEMBER(id),
+		REFLECT_MEMBER(symbol),
+		REFLECT_MEMBER(price),
+		REFLECT_MEMBER(limits),
+		REFLECT_MEMBER(fills),
+		REFLECT_MEMBER(account)
+	};
+};
+
+struct OrderDto
+{
+	std::int64_t id;
+	std::string symbol;
+	float price;
+	std::int64_t limits[3];
+	std::vector<std::int32_t> fills;
+	AccountDto account;
+
+	REFLECT_DEFINE(OrderDto) {
+		REFLECT_MEMBER(id),
+		REFLECT_MEMBER(symbol),
+		REFLECT_MEMBER(price),
+		REFLECT_MEMBER(limits),
+		REFLECT_MEMBER(fills),
+		REFLECT_MEMBER(account)
+	};
+};
+
+BENCH_NOINLINE void copy_handwritten(QuoteCopy& out, const Quote& q)
+{ out = { q.ts, q.px, q.bid_qty, q.ask_qty }; }
+
+BENCH_NOINLINE void copy_convert(QuoteCopy& out, const Quote& q)
+{ out = Reflect::convert<QuoteCopy>(q); }
+
+BENCH_NOINLINE void reorder_handwritten(QuoteReordered& out, const Quote& q)
+{ out = { q.px, q.ask_qty, q.bid_qty, q.ts }; }
+
+BENCH_NOINLINE void reorder_convert(QuoteReordered& out, const Quote& q)
+{ out = Reflect::convert<QuoteReordered>(q); }
+
+BENCH_NOINLINE void dto_handwritten(OrderDto& dto, const Order& o)
+{
+	dto.id = o.id;
+	dto.symbol = o.symbol;
+	dto.price = static_cast<float>(o.price);
+	for (int i = 0; i < 3; ++i)
+		dto.limits[i] = o.limits[i];
+	dto.fills = o.fills;
+	dto.account.level = o.account.level;
+	dto.account.id = o.account.id;
+}
+
+BENCH_NOINLINE void dto_convert(OrderDto& dto, const Order& o)
+{ Reflect::assign(dto, o); }
+
+constexpr std::size_t count = 1 << 22;
+
+int main()
+{
+	const Quote quote{ 1700000000, 101.25, 300, 200 };
+	const Order order{ 7, "a symbol longer than SSO", 99.5, { 1, 2, 3 }, { 10, 20, 30, 40 }, { "account id longer than SSO", 3 } };
+
+	// Results are written through a reference and not read back, reading back a struct
+	// written by narrower stores would measure store forwarding stalls instead.
+	const auto run = [&](const char* name, auto& out, const auto& in, auto func) {
+		bench::row(name, bench::ns_per_op(count, [&] {
+			for (std::size_t i = 0; i < count; ++i)
+			{
+				func(out, in);
+				bench::do_not_optimize(&out);
+			}
+		}), "ns/conversion");
+	};
+
+	std::printf("same layout\n");
+	QuoteCopy copy;
+	run("handwritten", copy, quote, copy_handwritten);
+	run("convert", copy, quote, copy_convert);
+
+	std::printf("reordered members\n");
+	QuoteReordered reordered;
+	run("handwritten", reordered, quote, reorder_handwritten);
+	run("convert", reordered, quote, reorder_convert);
+
+	// assign into the same object, so strings and vectors reuse their buffers in both cases
+	std::printf("Order -> OrderDto (strings, vector, nested, int[3] -> int64[3])\n");
+	OrderDto dto;
+	run("handwritten", dto, order, dto_handwritten);
+	run("assign", dto, order, dto_convert);
+	return 0;
+}
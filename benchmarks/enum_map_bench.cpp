@@ -0,0 +1,67 @@
+// enum_map lookups against std::unordered_map<Enum, V>, on a contiguous enum
+// and on a sparse one, keys in random order.
+
+#include <vector>
+#include <unordered_map>
+
+#include "SimpleReflect/EnumMap.hpp"
+#include "Benchmark.hpp"
+
+enum class Colors { Red, Green, Blue, Cyan, Magenta, Yellow, Black, White };
+
+enum class HttpStatus
+{
+	OK = 200, Created = 201, Accepted = 202, NoContent = 204,
+	Moved = 301, Found = 302, NotModified = 304,
+	BadRequest = 400, Unauthorized = 401, Forbidden = 403, NotFound = 404
+};
+
+template<>
+struct Reflect::Enums::ReflectConfig<HttpStatus>
+	: Reflect::Enums::ConfigBase<404, 200> {};
+
+constexpr std::size_t lookups = 1 << 20;
+
+template<typename Enum>
+void run(const char* title)
+{
+	std::vector<Enum> values;
+	for (const auto& [ name, value ] : Reflect::Enums::entries<Enum>())
+		values.push_back(value);
+
+	std::unordered_map<Enum, long> umap;
+	Reflect::Enums::enum_map<Enum, long> emap;
+	for (std::size_t i = 0; i < values.size(); ++i)
+	{
+		umap[values[i]] = long(i);
+		emap[values[i]] = long(i);
+	}
+
+	bench::Random random;
+	std::vector<Enum> keys(lookups);
+	for (auto& key : keys)
+		key = values[random() % values.size()];
+
+	std::printf("%s, %zu values, %zu random lookups\n", title, values.size(), lookups);
+	bench::row("std::unordered_map<Enum, V>::find", bench::ns_per_op(lookups, [&] {
+		long sum = 0;
+		for (auto key : keys)
+			if (auto it = umap.find(key); it != umap.end())
+				sum += it->second;
+		bench::do_not_optimize(sum);
+	}), "ns/lookup");
+	bench::row("enum_map<Enum, V>::find", bench::ns_per_op(lookups, [&] {
+		long sum = 0;
+		for (auto key : keys)
+			if (auto* value = emap.find(key))
+				sum += *value;
+		bench::do_not_optimize(sum);
+	}), "ns/lookup");
+}
+
+int main()
+{
+	run<Colors>("Colors (contiguous)");
+	run<HttpStatus>("HttpStatus (sparse)");
+	return 0;
+}
@@ -0,0 +1,65 @@
+// std::format of a reflected class against a handwritten std::format_to call.
+// Needs a standard library with <format>.
+
+#include <string>
+#include <format>
+#include <iterator>
+
+#include "SimpleReflect/Format.hpp"
+#include "Benchmark.hpp"
+
+struct Trade
+{
+	std::int64_t ts;
+	double px;
+	std::int32_t qty;
+	std::string sym;
+
+	REFLECT_DEFINE(Trade) {
+		REFLECT_MEMBER(ts),
+		REFLECT_MEMBER(px),
+		REFLECT_MEMBER(qty),
+		REFLECT_MEMBER(sym)
+	};
+};
+
+constexpr std::size_t count = 1 << 20;
+
+int main()
+{
+	const Trade trade{ 1700000000123456, 101.25, 300, "AAPL" };
+	std::string out;
+	out.reserve(256);
+
+	const auto handwritten = [&] {
+		out.clear();
+		std::format_to(std::back_inserter(out), "{{ts: {}, px: {}, qty: {}, sym: {}}}", trade.ts, trade.px, trade.qty, trade.sym);
+	};
+	const auto reflected = [&] {
+		out.clear();
+		std::format_to(std::back_inserter(out), "{}", trade);
+	};
+
+	handwritten();
+	const auto expected = out;
+	reflected();
+	std::printf("%s\n%s\n", expected.c_str(), out.c_str());
+	if (out != expected)
+		return 1;
+
+	bench::row("handwritten format_to", bench::ns_per_op(count, [&] {
+		for (std::size_t i = 0; i < count; ++i)
+		{
+			handwritten();
+			bench::do_not_optimize(out.data());
+		}
+	}), "ns/format");
+	bench::row("format_to(\"{}\", trade)", bench::ns_per_op(count, [&] {
+		for (std::size_t i = 0; i < count; ++i)
+		{
+			reflected();
+			bench::do_not_optimize(out.data());
+		}
+	}), "ns/format");
+	return 0;
+}
@@ -0,0 +1,45 @@
+// Cost of access instrumentation. Built twice, as instrument_bench (REFLECT_INSTRUMENT_ACCESS=0)
+// and instrument_bench_enabled (REFLECT_INSTRUMENT_ACCESS=1), compare their output.
+
+#include <vector>
+#include <iostream>
+
+#include "SimpleReflect/Reflect.hpp"
+#include "SimpleReflect/Instrument.hpp"
+#include "Benchmark.hpp"
+
+struct Order
+{
+	std::int64_t id;
+	double price;
+	std::int32_t qty;
+	std::int32_t flags;
+
+	REFLECT_DEFINE(Order) {
+		REFLECT_MEMBER(id),
+		REFLECT_MEMBER(price),
+		REFLECT_MEMBER(qty),
+		REFLECT_MEMBER(flags)
+	};
+};
+
+constexpr std::size_t count = 1 << 20;
+
+int main()
+{
+	std::vector<Order> orders(count);
+	for (std::size_t i = 0; i < count; ++i)
+		orders[i] = { std::int64_t(i), 1.0 + double(i % 100), std::int32_t(i % 7), 0 };
+
+	std::printf("REFLECT_INSTRUMENT_ACCESS=%d, %zu elements, two get_member per element\n",
+		REFLECT_INSTRUMENT_ACCESS, count);
+	bench::row("get_member<\"price\"> * get_member<\"qty\">", bench::ns_per_op(count, [&] {
+		double sum = 0;
+		for (auto& order : orders)
+			sum += Reflect::get_member<"price">(&order) * Reflect::get_member<"qty">(&order);
+		bench::do_not_optimize(sum);
+	}), "ns/element");
+
+	std::cout << Reflect::access_report();
+	return 0;
+}
@@ -0,0 +1,85 @@
+// where / and_ on std::vector and column_store against scalar loops over the same data.
+
+#include <span>
+#include <vector>
+
+#include "SimpleReflect/Query.hpp"
+#include "Benchmark.hpp"
+
+struct Order
+{
+	std::int64_t id;
+	double price;
+	std::int32_t qty;
+	std::int32_t side;
+	char account[16];
+
+	REFLECT_DEFINE(Order) {
+		REFLECT_MEMBER(id),
+		REFLECT_MEMBER(price),
+		REFLECT_MEMBER(qty),
+		REFLECT_MEMBER(side),
+		REFLECT_MEMBER(account)
+	};
+};
+
+constexpr std::size_t count = 10'000'000;
+
+int main()
+{
+	bench::Random random;
+	std::vector<Order> orders(count);
+	for (std::size_t i = 0; i < count; ++i)
+	{
+		orders[i].id    = static_cast<std::int64_t>(i);
+		orders[i].price = static_cast<double>(random() % 20000) / 100.0;
+		orders[i].qty   = static_cast<std::int32_t>(random() % 100);
+	}
+	const Reflect::column_store<Order> columns{ orders };
+
+	std::size_t expected = 0;
+	for (const auto& order : orders)
+		expected += order.price > 100.0 && order.qty < 10;
+
+	std::printf("%zu rows of %zu bytes, price > 100 && qty < 10 matches %zu rows\n", count, sizeof(Order), expected);
+
+	bool ok = true;
+	const auto check = [&](std::size_t matched) {
+		ok &= matched == expected;
+		bench::do_not_optimize(matched);
+	};
+
+	std::printf("std::vector<Order>\n");
+	bench::row("scalar loop", bench::ns_per_op(count, [&] {
+		std::size_t matched = 0;
+		for (const auto& order : orders)
+			matched += (order.price > 100.0) & (order.qty < 10);
+		check(matched);
+	}), "ns/row");
+	bench::row("where<\"price\">.and_<\"qty\">", bench::ns_per_op(count, [&] {
+		check(Reflect::where<"price">(orders, Reflect::gt(100.0)).and_<"qty">(Reflect::lt(10)).count());
+	}), "ns/row");
+	bench::row("where<\"price\", \"qty\">", bench::ns_per_op(count, [&] {
+		check(Reflect::where<"price", "qty">(orders, Reflect::gt(100.0), Reflect::lt(10)).count());
+	}), "ns/row");
+
+	std::printf("column_store<Order>\n");
+	bench::row("scalar loop over price and qty columns", bench::ns_per_op(count, [&] {
+		const auto price = columns.column<"price">();
+		const auto qty   = columns.column<"qty">();
+		std::size_t matched = 0;
+		for (std::size_t i = 0; i < count; ++i)
+			matched += (price[i] > 100.0) & (qty[i] < 10);
+		check(matched);
+	}), "ns/row");
+	bench::row("where<\"price\">.and_<\"qty\">", bench::ns_per_op(count, [&] {
+		check(Reflect::where<"price">(columns, Reflect::gt(100.0)).and_<"qty">(Reflect::lt(10)).count());
+	}), "ns/row");
+	bench::row("where<\"price\", \"qty\">", bench::ns_per_op(count, [&] {
+		check(Reflect::where<"price", "qty">(columns, Reflect::gt(100.0), Reflect::lt(10)).count());
+	}), "ns/row");
+
+	if (!ok)
+		std::printf("MISMATCH\n");
+	return ok ? 0 : 1;
+}
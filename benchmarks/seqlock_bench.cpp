@@ -0,0 +1,116 @@
+// seqlock_cell against std::shared_mutex, one writer and N readers.
+// Every snapshot is checked for consistency: all members are written from the same counter.
+
+#include <mutex>
+#include <atomic>
+#include <thread>
+#include <vector>
+#include <shared_mutex>
+
+#include "SimpleReflect/Seqlock.hpp"
+#include "Benchmark.hpp"
+
+struct Quote
+{
+	std::int64_t seq;
+	double bid;
+	double ask;
+	std::int64_t bid_qty;
+	std::int64_t ask_qty;
+	std::int64_t time;
+	std::int64_t check;
+
+	REFLECT_DEFINE(Quote) {
+		REFLECT_MEMBER(seq),
+		REFLECT_MEMBER(bid),
+		REFLECT_MEMBER(ask),
+		REFLECT_MEMBER(bid_qty),
+		REFLECT_MEMBER(ask_qty),
+		REFLECT_MEMBER(time),
+		REFLECT_MEMBER(check)
+	};
+};
+
+Quote make_quote(std::int64_t i) noexcept
+{ return { i, double(i), double(i) + 1, i * 2, i * 3, i * 4, i * 5 }; }
+
+bool consistent(const Quote& q) noexcept
+{
+	const auto i = q.seq;
+	return q.bid == double(i) && q.ask == double(i) + 1 && q.bid_qty == i * 2 && q.ask_qty == i * 3
+		&& q.time == i * 4 && q.check == i * 5;
+}
+
+struct SharedMutexCell
+{
+	mutable std::shared_mutex mutex;
+	Quote value{};
+
+	void store(const Quote& q)
+	{
+		std::unique_lock lock{ mutex };
+		value = q;
+	}
+
+	Quote load() const
+	{
+		std::shared_lock lock{ mutex };
+		return value;
+	}
+};
+
+constexpr auto duration = std::chrono::milliseconds(500);
+
+template<typename Cell>
+void run(const char* name, std::size_t readers)
+{
+	Cell cell;
+	cell.store(make_quote(0));
+	std::atomic<bool> stop = false;
+	std::atomic<std::uint64_t> reads = 0;
+	std::atomic<bool> ok = true;
+
+	std::vector<std::jthread> threads;
+	for (std::size_t r = 0; r < readers; ++r)
+	{
+		threads.emplace_back([&] {
+			std::uint64_t count = 0;
+			bool good = true;
+			while (!stop.load(std::memory_order_relaxed))
+			{
+				good &= consistent(cell.load());
+				++count;
+			}
+			reads += count;
+			if (!good)
+				ok = false;
+		});
+	}
+
+	std::uint64_t writes = 0;
+	const auto start = std::chrono::steady_clock::now();
+	while (std::chrono::steady_clock::now() - start < duration)
+	{
+		for (int i = 0; i < 64; ++i)
+			cell.store(make_quote(static_cast<std::int64_t>(++writes)));
+	}
+	stop = true;
+	threads.clear();
+
+	const double seconds = std::chrono::duration<double>(duration).count();
+	std::printf("  %-18s N=%zu  reads %8.2f M/s  writes %8.2f M/s  %s\n", name, readers,
+		static_cast<double>(reads) / seconds / 1e6, static_cast<double>(writes) / seconds / 1e6,
+		ok ? "consistent" : "TORN READS");
+}
+
+int main()
+{
+	std::printf("1 writer, N readers, %zu byte struct, %u hardware threads\n",
+		sizeof(Quote), std::thread::hardware_concurrency());
+	for (std::size_t readers : { 1, 2, 4 })
+	{
+		run<Reflect::seqlock_cell<Quote>>("seqlock_cell", readers);
+		run<SharedMutexCell>("std::shared_mutex", readers);
+	}
+	return 0;
+}
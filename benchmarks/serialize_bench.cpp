@@ -0,0 +1,116 @@
+// Decoding a message with many strings and vectors, with the default allocator
+// against Reflect::arena. Reports allocations per message and latency percentiles.
+
+#include <string>
+#include <vector>
+#include <memory_resource>
+
+#include "SimpleReflect/Serialize.hpp"
+#include "Benchmark.hpp"
+
+struct Leg
+{
+	std::int64_t id;
+	double price;
+	std::pmr::string venue;
+
+	REFLECT_DEFINE(Leg) {
+		REFLECT_MEMBER(id),
+		REFLECT_MEMBER(price),
+		REFLECT_MEMBER(venue)
+	};
+};
+
+struct Order
+{
+	std::int64_t id;
+	std::pmr::string account;
+	std::pmr::vector<std::pmr::string> tags;
+	std::pmr::vector<Leg> legs;
+
+	REFLECT_DEFINE(Order) {
+		REFLECT_MEMBER(id),
+		REFLECT_MEMBER(account),
+		REFLECT_MEMBER(tags),
+		REFLECT_MEMBER(legs)
+	};
+};
+
+// Counts allocations passed on to new / delete.
+class counting_resource : public std::pmr::memory_resource
+{
+public:
+	std::size_t allocations = 0;
+
+private:
+	void* do_allocate(std::size_t bytes, std::size_t alignment) override
+	{
+		++allocations;
+		return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+	}
+
+	void do_deallocate(void* ptr, std::size_t bytes, std::size_t alignment) override
+	{ std::pmr::new_delete_resource()->deallocate(ptr, bytes, alignment); }
+
+	bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override
+	{ return this == &other; }
+};
+
+constexpr std::size_t messages = 100'000;
+
+// Decode the message messages times, each into a fresh object, return latencies in ns.
+template<typename Decode>
+std::vector<double> run(Decode&& decode)
+{
+	std::vector<double> samples;
+	samples.reserve(messages);
+	for (std::size_t i = 0; i < messages; ++i)
+	{
+		const auto start = std::chrono::steady_clock::now();
+		decode();
+		samples.push_back(bench::seconds_since(start) * 1e9);
+	}
+	return samples;
+}
+
+void report(const char* name, std::vector<double> samples, std::size_t allocations)
+{
+	std::printf("%s\n", name);
+	bench::row("allocations", static_cast<double>(allocations) / messages, "per message");
+	bench::row("p50", bench::percentile(samples, 0.50), "ns");
+	bench::row("p99", bench::percentile(samples, 0.99), "ns");
+}
+
+int main()
+{
+	counting_resource counter;
+	std::pmr::set_default_resource(&counter);
+
+	Order order{ 42, "account of a long enough name", {}, {} };
+	for (int i = 0; i < 12; ++i)
+		order.tags.emplace_back("tag number " + std::to_string(i) + " of the order");
+	for (int i = 0; i < 8; ++i)
+		order.legs.push_back({ i, 100.0 + i, std::pmr::string{ "venue with a long name #" + std::to_string(i) } });
+	const auto buffer = Reflect::serialize(order);
+	std::printf("%zu byte message, %zu tags, %zu legs, %zu decodes\n",
+		buffer.size(), order.tags.size(), order.legs.size(), messages);
+
+	counter.allocations = 0;
+	auto samples = run([&] {
+		Order msg;
+		bench::do_not_optimize(Reflect::deserialize(buffer, msg));
+	});
+	report("default allocator", std::move(samples), counter.allocations);
+
+	counter.allocations = 0;
+	Reflect::arena<8192> arena{ &counter };
+	samples = run([&] {
+		{
+			Order msg;
+			bench::do_not_optimize(Reflect::deserialize(buffer, msg, &arena));
+		}
+		arena.release();
+	});
+	report("Reflect::arena<8192>", std::move(samples), counter.allocations);
+	return 0;
+}
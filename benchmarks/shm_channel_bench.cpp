@@ -0,0 +1,232 @@
+// shm_channel against a Unix domain socket between two processes:
+// messages per second one way, and round trip latency (ping pong).
+
+#include <thread>
+#include <string>
+#include <cstring>
+
+#include <unistd.h>
+#include <sys/wait.h>
+#include <sys/socket.h>
+
+#include "SimpleReflect/ShmChannel.hpp"
+#include "Benchmark.hpp"
+
+struct Quote
+{
+	std::uint64_t seq;
+	std::int64_t ts;
+	double bid;
+	double ask;
+	std::int32_t bid_qty;
+	std::int32_t ask_qty;
+	char symbol[16];
+	std::uint64_t flags;
+
+	REFLECT_DEFINE(Quote) {
+		REFLECT_MEMBER(seq),
+		REFLECT_MEMBER(ts),
+		REFLECT_MEMBER(bid),
+		REFLECT_MEMBER(ask),
+		REFLECT_MEMBER(bid_qty),
+		REFLECT_MEMBER(ask_qty),
+		REFLECT_MEMBER(symbol),
+		REFLECT_MEMBER(flags)
+	};
+};
+
+constexpr std::uint64_t messages    = 2'000'000;
+constexpr std::uint64_t round_trips = 100'000;
+
+using Channel = Reflect::shm_channel<Quote>;
+
+// Waiting yields, so both processes make progress on a single core too.
+void backoff() { std::this_thread::yield(); }
+
+bool child_ok(pid_t pid)
+{
+	int status = 0;
+	::waitpid(pid, &status, 0);
+	return WIFEXITED(status) && WEXITSTATUS(status) == 0;
+}
+
+void report(const char* name, double one_way_seconds, double round_trip_seconds, bool ok)
+{
+	std::printf("%s%s\n", name, ok ? "" : " (FAILED)");
+	bench::row("one way", static_cast<double>(messages) / one_way_seconds / 1e6, "M messages/s");
+	bench::row("round trip", round_trip_seconds * 1e9 / round_trips, "ns");
+}
+
+void run_shm()
+{
+	const std::string name = "/simple_reflect_bench_" + std::to_string(::getpid());
+	auto requests = Channel::create(name, 4096);
+	auto replies  = Channel::create(name + "_replies", 4096);
+
+	const pid_t pid = ::fork();
+	if (pid == 0)
+	{
+		auto in  = Channel::open(name);
+		auto out = Channel::open(name + "_replies");
+
+		// records are checked in place
+		std::uint64_t expected = 0;
+		bool ok = true;
+		while (expected < messages)
+		{
+			if (in.consume([&](const Quote& q) { ok &= q.seq == expected++; }) == 0)
+				backoff();
+		}
+
+		for (std::uint64_t i = 0; i < round_trips; ++i)
+		{
+			const Quote* request;
+			while ((request = in.try_front()) == nullptr)
+				backoff();
+			Quote* reply;
+			while ((reply = out.try_prepare()) == nullptr)
+				backoff();
+			*reply = *request;
+			in.pop();
+			out.commit();
+		}
+		::_exit(ok ? 0 : 1);
+	}
+
+	auto start = std::chrono::steady_clock::now();
+	for (std::uint64_t i = 0; i < messages; ++i)
+	{
+		Quote* q;
+		while ((q = requests.try_prepare()) == nullptr)
+			backoff();
+		q->seq = i;
+		q->bid = 1.0;
+		requests.commit();
+	}
+	while (requests.size() != 0)
+		backoff();
+	const double one_way = bench::seconds_since(start);
+
+	start = std::chrono::steady_clock::now();
+	bool ok = true;
+	for (std::uint64_t i = 0; i < round_trips; ++i)
+	{
+		Quote* q;
+		while ((q = requests.try_prepare()) == nullptr)
+			backoff();
+		q->seq = i;
+		requests.commit();
+
+		const Quote* reply;
+		while ((reply = replies.try_front()) == nullptr)
+			backoff();
+		ok &= reply->seq == i;
+		replies.pop();
+	}
+	const double round_trip = bench::seconds_since(start);
+
+	ok &= child_ok(pid);
+	Channel::unlink(name);
+	Channel::unlink(name + "_replies");
+	report("shm_channel", one_way, round_trip, ok);
+}
+
+bool read_all(int fd, void* data, std::size_t size)
+{
+	auto* bytes = static_cast<char*>(data);
+	while (size != 0)
+	{
+		const auto n = ::read(fd, bytes, size);
+		if (n <= 0)
+			return false;
+		bytes += n;
+		size -= static_cast<std::size_t>(n);
+	}
+	return true;
+}
+
+bool write_all(int fd, const void* data, std::size_t size)
+{
+	const auto* bytes = static_cast<const char*>(data);
+	while (size != 0)
+	{
+		const auto n = ::write(fd, bytes, size);
+		if (n <= 0)
+			return false;
+		bytes += n;
+		size -= static_cast<std::size_t>(n);
+	}
+	return true;
+}
+
+void run_socket()
+{
+	int fds[2];
+	if (::socketpair(AF_UNIX, SOCK_STREAM, 0, fds) != 0)
+		return;
+
+	const pid_t pid = ::fork();
+	if (pid == 0)
+	{
+		::close(fds[0]);
+		const int fd = fds[1];
+
+		// read in batches, like a consumer would
+		constexpr std::size_t batch = 64;
+		Quote buffer[batch];
+		std::uint64_t received = 0;
+		bool ok = true;
+		while (received < messages)
+		{
+			const auto count = std::min<std::uint64_t>(batch, messages - received);
+			if (!read_all(fd, buffer, count * sizeof(Quote)))
+				::_exit(2);
+			for (std::size_t i = 0; i < count; ++i)
+				ok &= buffer[i].seq == received++;
+		}
+
+		for (std::uint64_t i = 0; i < round_trips; ++i)
+		{
+			Quote q;
+			if (!read_all(fd, &q, sizeof(q)) || !write_all(fd, &q, sizeof(q)))
+				::_exit(2);
+		}
+		::_exit(ok ? 0 : 1);
+	}
+	::close(fds[1]);
+	const int fd = fds[0];
+
+	bool ok = true;
+	auto start = std::chrono::steady_clock::now();
+	for (std::uint64_t i = 0; i < messages; ++i)
+	{
+		Quote q{};
+		q.seq = i;
+		q.bid = 1.0;
+		ok &= write_all(fd, &q, sizeof(q));
+	}
+	const double one_way = bench::seconds_since(start);
+
+	start = std::chrono::steady_clock::now();
+	for (std::uint64_t i = 0; i < round_trips; ++i)
+	{
+		Quote q{};
+		q.seq = i;
+		ok &= write_all(fd, &q, sizeof(q)) && read_all(fd, &q, sizeof(q)) && q.seq == i;
+	}
+	const double round_trip = bench::seconds_since(start);
+
+	::close(fd);
+	ok &= child_ok(pid);
+	report("Unix domain socket", one_way, round_trip, ok);
+}
+
+int main()
+{
+	std::printf("%zu byte messages, %llu one way, %llu round trips, %u hardware threads\n",
+		sizeof(Quote), (unsigned long long)messages, (unsigned long long)round_trips,
+		std::thread::hardware_concurrency());
+	run_shm();
+	run_socket();
+	return 0;
+}
@@ -0,0 +1,86 @@
+// sort_by and parallel_sort_by against std::sort with a handwritten comparator.
+
+#include <thread>
+#include <vector>
+#include <algorithm>
+
+#include "SimpleReflect/Sort.hpp"
+#include "Benchmark.hpp"
+
+enum class Side : std::uint8_t { Buy, Sell };
+
+struct Order
+{
+	std::int64_t time;
+	Side side;
+	std::int32_t price;
+	double qty;
+	char account[56];
+
+	REFLECT_DEFINE(Order) {
+		REFLECT_MEMBER(time),
+		REFLECT_MEMBER(side),
+		REFLECT_MEMBER(price),
+		REFLECT_MEMBER(qty),
+		REFLECT_MEMBER(account)
+	};
+};
+
+constexpr std::size_t count = 1 << 20;
+
+// ms to sort a fresh copy of input
+template<typename Sort>
+double sort_ms(const std::vector<Order>& input, Sort&& sort)
+{
+	double best = 1e300;
+	for (int i = 0; i < 3; ++i)
+	{
+		auto data = input;
+		const auto start = std::chrono::steady_clock::now();
+		sort(data);
+		best = std::min(best, bench::seconds_since(start) * 1e3);
+		bench::do_not_optimize(data.front());
+	}
+	return best;
+}
+
+int main()
+{
+	bench::Random random;
+	std::vector<Order> orders(count);
+	for (auto& order : orders)
+	{
+		order.time  = static_cast<std::int64_t>(random() >> 1);
+		order.side  = static_cast<Side>(random() & 1);
+		order.price = static_cast<std::int32_t>(random() % 100000) - 50000;
+		order.qty   = 1.0;
+	}
+
+	std::printf("%zu records of %zu bytes, %u hardware threads\n",
+		count, sizeof(Order), std::thread::hardware_concurrency());
+
+	std::printf("int64 key\n");
+	bench::row("std::sort with lambda", sort_ms(orders, [](auto& data) {
+		std::sort(data.begin(), data.end(), [](const Order& a, const Order& b) { return a.time < b.time; });
+	}), "ms");
+	bench::row("sort_by<\"time\">", sort_ms(orders, [](auto& data) {
+		Reflect::sort_by<"time">(data);
+	}), "ms");
+	bench::row("parallel_sort_by<\"time\">", sort_ms(orders, [](auto& data) {
+		Reflect::parallel_sort_by<"time">(data);
+	}), "ms");
+
+	std::printf("(enum, int32) keys\n");
+	bench::row("std::sort with lambda", sort_ms(orders, [](auto& data) {
+		std::sort(data.begin(), data.end(), [](const Order& a, const Order& b) {
+			return a.side != b.side ? a.side < b.side : a.price < b.price;
+		});
+	}), "ms");
+	bench::row("sort_by<\"side\", \"price\">", sort_ms(orders, [](auto& data) {
+		Reflect::sort_by<"side", "price">(data);
+	}), "ms");
+	bench::row("parallel_sort_by<\"side\", \"price\">", sort_ms(orders, [](auto& data) {
+		Reflect::parallel_sort_by<"side", "price">(data);
+	}), "ms");
+	return 0;
+}
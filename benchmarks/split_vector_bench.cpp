@@ -0,0 +1,59 @@
+// Scanning hot members of split_vector against std::vector of the whole struct.
+
+#include <vector>
+
+#include "SimpleReflect/SplitVector.hpp"
+#include "Benchmark.hpp"
+
+struct Order
+{
+	std::int64_t id;
+	double price;
+	std::int32_t qty;
+	char comment[96];
+	double fees[4];
+
+	REFLECT_DEFINE(Order) {
+		REFLECT_MEMBER(id),
+		REFLECT_MEMBER(price),
+		REFLECT_MEMBER(qty),
+		REFLECT_MEMBER_COLD(comment),
+		REFLECT_MEMBER_COLD(fees)
+	};
+};
+
+constexpr std::size_t count = 1 << 21;
+
+int main()
+{
+	std::vector<Order> plain(count);
+	Reflect::split_vector<Order> split;
+	split.reserve(count);
+	for (std::size_t i = 0; i < count; ++i)
+	{
+		plain[i] = { std::int64_t(i), 1.0 + double(i % 100), std::int32_t(i % 10), "comment", { 0.1, 0.2, 0.3, 0.4 } };
+		split.push_back(plain[i]);
+	}
+
+	std::printf("%zu elements, filter on qty and sum price\n", count);
+	bench::row("std::vector<Order> bytes scanned", sizeof(Order), "bytes/element");
+	bench::row("split_vector<Order> bytes scanned", sizeof(Reflect::split_vector<Order>::hot_type), "bytes/element");
+	bench::row("std::vector<Order> cache lines", sizeof(Order) / 64.0, "lines/element");
+	bench::row("split_vector<Order> cache lines", sizeof(Reflect::split_vector<Order>::hot_type) / 64.0, "lines/element");
+
+	bench::row("std::vector<Order>", bench::ns_per_op(count, [&] {
+		double sum = 0;
+		for (const auto& order : plain)
+			if (order.qty > 3)
+				sum += order.price;
+		bench::do_not_optimize(sum);
+	}), "ns/element");
+	bench::row("split_vector<Order>", bench::ns_per_op(count, [&] {
+		double sum = 0;
+		for (auto order : std::as_const(split))
+			if (Reflect::get_member<"qty">(order) > 3)
+				sum += Reflect::get_member<"price">(order);
+		bench::do_not_optimize(sum);
+	}), "ns/element");
+	return 0;
+}
@@ -0,0 +1,61 @@
+// type_map keyed by type_id_v against std::unordered_map keyed by std::type_index,
+// looking up handlers of 64 message types in random order.
+
+#include <vector>
+#include <typeindex>
+#include <unordered_map>
+
+#include "SimpleReflect/TypeMap.hpp"
+#include "Benchmark.hpp"
+
+template<std::size_t N>
+struct Message {};
+
+constexpr std::size_t type_count = 64;
+constexpr std::size_t lookups    = 1 << 20;
+
+template<std::size_t ...N>
+void register_all(std::index_sequence<N...>,
+	Reflect::type_map<int>& map, std::unordered_map<std::type_index, int>& umap,
+	std::vector<std::uint64_t>& ids, std::vector<std::type_index>& indices)
+{
+	(map.insert_or_assign<Message<N>>(int(N)), ...);
+	((umap[typeid(Message<N>)] = int(N)), ...);
+	ids = { Reflect::type_id_v<Message<N>>... };
+	indices = { std::type_index(typeid(Message<N>))... };
+}
+
+int main()
+{
+	Reflect::type_map<int> map;
+	std::unordered_map<std::type_index, int> umap;
+	std::vector<std::uint64_t> ids;
+	std::vector<std::type_index> indices;
+	register_all(std::make_index_sequence<type_count>{}, map, umap, ids, indices);
+
+	// the same random sequence of types for both
+	bench::Random random;
+	std::vector<std::uint64_t> id_keys(lookups);
+	std::vector<std::type_index> index_keys(lookups, typeid(void));
+	for (std::size_t i = 0; i < lookups; ++i)
+	{
+		const auto type = random() % type_count;
+		id_keys[i] = ids[type];
+		index_keys[i] = indices[type];
+	}
+
+	std::printf("%zu message types, %zu random lookups\n", type_count, lookups);
+	bench::row("type_map<V>::find(type_id)", bench::ns_per_op(lookups, [&] {
+		int sum = 0;
+		for (auto id : id_keys)
+			sum += *map.find(id);
+		bench::do_not_optimize(sum);
+	}), "ns/lookup");
+	bench::row("unordered_map<type_index, V>::find", bench::ns_per_op(lookups, [&] {
+		int sum = 0;
+		for (auto index : index_keys)
+			sum += umap.find(index)->second;
+		bench::do_not_optimize(sum);
+	}), "ns/lookup");
+	return 0;
+}
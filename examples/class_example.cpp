@@ -8,6 +8,7 @@ void print(std::format_string<Args...> fmt, Args&& ...args)
 	std::format_to(std::ostreambuf_iterator<char>(std::cout), fmt, std::forward<Args>(args)...);
 }
 #include "SimpleReflect/Reflect.hpp"
+#include "SimpleReflect/Format.hpp"
 
 struct A
 {
@@ -181,6 +182,10 @@ int main()
 	::print("\b\b \n");
 	::print("------------------\n");
 	::print("a = {}\n", Reflect::get_member<"a">(x));
+	::print("------------------\n");
+	// std::formatter for reflected classes
+	::print("x = {}\n", x);
+	::print("y = {:p}\n", y);
 
 	return 0;
 }
\ No newline at end of file
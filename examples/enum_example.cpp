@@ -32,6 +32,19 @@ struct Reflect::Enums::ReflectConfig<HttpStatus>
 // Inheritance of Reflect::Enums::Config class is not needed,
 // just make sure specialized ReflectConfig class has required static members.
 
+enum class Permission : unsigned char
+{
+	None  = 0,
+	Read  = 1 << 0,
+	Write = 1 << 1,
+	Exec  = 1 << 2
+};
+
+// Bit flags enum, only single bit values are reflected
+template<>
+struct Reflect::Enums::ReflectConfig<Permission>
+	: Reflect::Enums::FlagsConfigBase {};
+
 int main()
 {
 	Reflect::Enums::EntryArray arr{ Reflect::Enums::entries<Colors>() };
@@ -50,5 +63,14 @@ int main()
 	code = (HttpStatus)404;
 
 	print("{}\n", to_string(code));
+
+	print("----------------------------\n");
+	char buffer[64];
+	print("{}\n", to_string(Permission::Read, buffer));
+	print("{}\n", to_string((Permission)6, buffer));
+	print("{}\n", to_string(Reflect::Enums::all_flags_v<Permission>, buffer));
+
+	auto perm = Reflect::Enums::from_string<Permission>("Permission::Read|Permission::Exec");
+	print("{}\n", (int)perm.value_or(Permission::None));
 	return 0;
 }
\ No newline at end of file
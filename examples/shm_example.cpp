@@ -0,0 +1,132 @@
+#include <thread>
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include <stdexcept>
+#include <system_error>
+
+#include <unistd.h>
+#include <sys/wait.h>
+
+#include "SimpleReflect/Reflect.hpp"
+#include "SimpleReflect/ShmChannel.hpp"
+
+struct Quote
+{
+	std::uint64_t seq;
+	double bid;
+	double ask;
+	char symbol[8];
+
+	REFLECT_DEFINE(Quote) {
+		REFLECT_MEMBER(seq),
+		REFLECT_MEMBER(bid),
+		REFLECT_MEMBER(ask),
+		REFLECT_MEMBER(symbol)
+	};
+};
+
+// Same members in a different order, so the layout differs
+struct QuoteV2
+{
+	std::uint64_t seq;
+	double ask;
+	double bid;
+	char symbol[8];
+
+	REFLECT_DEFINE(QuoteV2) {
+		REFLECT_MEMBER(seq),
+		REFLECT_MEMBER(bid),
+		REFLECT_MEMBER(ask),
+		REFLECT_MEMBER(symbol)
+	};
+};
+
+constexpr std::uint64_t count = 100'000;
+
+// Child process: echo every quote back with bid and ask swapped.
+int echo(const std::string& requests_name, const std::string& replies_name)
+{
+	auto requests = Reflect::shm_channel<Quote>::open(requests_name);
+	auto replies  = Reflect::shm_channel<Quote>::open(replies_name);
+	for (std::uint64_t i = 0; i < count; ++i)
+	{
+		const Quote* request;
+		while ((request = requests.try_front()) == nullptr)
+			std::this_thread::yield();
+		Quote* reply;
+		while ((reply = replies.try_prepare()) == nullptr)
+			std::this_thread::yield();
+		*reply = *request;
+		std::swap(reply->bid, reply->ask);
+		requests.pop();
+		replies.commit();
+	}
+	return 0;
+}
+
+int main()
+{
+	bool ok = true;
+	const std::string requests_name = "/simple_reflect_example_" + std::to_string(::getpid());
+	const std::string replies_name  = requests_name + "_replies";
+
+	auto requests = Reflect::shm_channel<Quote>::create(requests_name, 64);
+	auto replies  = Reflect::shm_channel<Quote>::create(replies_name, 64);
+
+	// An existing channel is not replaced
+	try
+	{
+		Reflect::shm_channel<Quote>::create(requests_name, 64);
+		ok = false;
+	}
+	catch (const std::system_error& e)
+	{
+		std::cout << "create again: " << e.what() << "\n";
+	}
+
+	// A peer with a different layout is refused
+	try
+	{
+		Reflect::shm_channel<QuoteV2>::open(requests_name);
+		ok = false;
+	}
+	catch (const std::runtime_error& e)
+	{
+		std::cout << "open as QuoteV2: " << e.what() << "\n";
+	}
+
+	const pid_t pid = ::fork();
+	if (pid < 0)
+		return 1;
+	if (pid == 0)
+		::_exit(echo(requests_name, replies_name));
+
+	// Round trip of count quotes, the replies are read in place
+	for (std::uint64_t i = 0; i < count; ++i)
+	{
+		Quote* request;
+		while ((request = requests.try_prepare()) == nullptr)
+			std::this_thread::yield();
+		*request = Quote{ i, 1.0 + i, 2.0 + i, "ABC" };
+		requests.commit();
+
+		const Quote* reply;
+		while ((reply = replies.try_front()) == nullptr)
+			std::this_thread::yield();
+		if (reply->seq != i || reply->bid != 2.0 + i || reply->ask != 1.0 + i || std::strcmp(reply->symbol, "ABC") != 0)
+			ok = false;
+		replies.pop();
+	}
+
+	int status = 0;
+	::waitpid(pid, &status, 0);
+	ok = ok && WIFEXITED(status) && WEXITSTATUS(status) == 0;
+
+	Reflect::shm_channel<Quote>::unlink(requests_name);
+	Reflect::shm_channel<Quote>::unlink(replies_name);
+
+	std::cout << count << " round trips between two processes\n";
+	std::cout << (ok ? "OK" : "FAILED") << "\n";
+	return ok ? 0 : 1;
+}
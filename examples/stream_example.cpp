@@ -0,0 +1,127 @@
+#include <new>
+#include <atomic>
+#include <string>
+#include <vector>
+#include <cstdlib>
+#include <iostream>
+#include <algorithm>
+
+#include "SimpleReflect/Reflect.hpp"
+#include "SimpleReflect/Stream.hpp"
+
+// Count live heap bytes, to check that streaming does not grow with the number of objects.
+static std::atomic<std::size_t> live_bytes = 0;
+static std::atomic<std::size_t> peak_bytes = 0;
+
+void* operator new(std::size_t size)
+{
+	auto* block = static_cast<std::size_t*>(std::malloc(size + sizeof(std::max_align_t)));
+	if (block == nullptr)
+		throw std::bad_alloc{};
+	*block = size;
+	const auto live = live_bytes += size;
+	auto peak = peak_bytes.load();
+	while (live > peak && !peak_bytes.compare_exchange_weak(peak, live)) {}
+	return reinterpret_cast<std::byte*>(block) + sizeof(std::max_align_t);
+}
+
+void operator delete(void* ptr) noexcept
+{
+	if (ptr == nullptr)
+		return;
+	auto* block = reinterpret_cast<std::size_t*>(static_cast<std::byte*>(ptr) - sizeof(std::max_align_t));
+	live_bytes -= *block;
+	std::free(block);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept
+{ ::operator delete(ptr); }
+
+struct Point
+{
+	float x, y;
+
+	REFLECT_DEFINE(Point) {
+		REFLECT_MEMBER(x),
+		REFLECT_MEMBER(y)
+	};
+};
+
+struct Record
+{
+	int id;
+	std::string name;
+	std::vector<Point> path;
+
+	REFLECT_DEFINE(Record) {
+		REFLECT_MEMBER(id),
+		REFLECT_MEMBER(name),
+		REFLECT_MEMBER(path)
+	};
+};
+
+// Generates records on the fly, so the input itself does not take memory.
+auto make_records(int count)
+{
+	return std::views::iota(0, count) | std::views::transform([](int i) {
+		Record r{ i, "record #" + std::to_string(i) + std::string(i % 50, '.'), {} };
+		for (int p = 0; p < i % 7; ++p)
+			r.path.push_back({ float(p), float(i) });
+		return r;
+	});
+}
+
+// Peak heap bytes used while streaming count records in chunks of chunk_size.
+std::size_t stream_peak(int count, std::size_t chunk_size)
+{
+	std::size_t total = 0;
+	const auto base = live_bytes.load();
+	peak_bytes = base;
+	for (auto chunk : Reflect::serialize_stream(make_records(count), chunk_size))
+		total += chunk.size();
+	if (total == 0)
+		return 0;
+	return peak_bytes - base;
+}
+
+int main()
+{
+	bool ok = true;
+
+	// Streamed chunks concatenated are the same bytes as serialize on each record,
+	// for chunk sizes smaller, around and larger than a record.
+	std::vector<std::byte> expected;
+	for (const auto& record : make_records(1000))
+		Reflect::serialize(record, expected);
+
+	for (std::size_t chunk_size : { 1, 7, 64, 4096, 1 << 20 })
+	{
+		std::vector<std::byte> streamed;
+		std::size_t chunks = 0;
+		for (auto chunk : Reflect::serialize_stream(make_records(1000), chunk_size))
+		{
+			if (chunk.size() > chunk_size)
+				ok = false;
+			streamed.insert(streamed.end(), chunk.begin(), chunk.end());
+			++chunks;
+		}
+		const bool same = streamed == expected;
+		ok = ok && same;
+		std::cout << "chunk size " << chunk_size << ": " << chunks << " chunks, "
+			<< streamed.size() << " bytes, " << (same ? "same as serialize" : "DIFFERENT") << "\n";
+	}
+
+	// Peak memory does not depend on number of records, it stays around the chunk size
+	// (plus the coroutine frame and one record being encoded).
+	constexpr std::size_t chunk_size = 4096;
+	constexpr std::size_t bound = chunk_size + 1024;
+	for (int count : { 1'000, 1'000'000 })
+	{
+		const auto peak = stream_peak(count, chunk_size);
+		std::cout << "peak heap while streaming " << count << " records: " << peak << " bytes\n";
+		ok = ok && peak <= bound;
+	}
+
+	std::cout << (ok ? "OK" : "FAILED") << "\n";
+	return ok ? 0 : 1;
+}
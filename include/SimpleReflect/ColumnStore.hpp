@@ -0,0 +1,147 @@
+#ifndef __SIMPLE_REFLECT_COLUMN_STORE_HEADER__
+#define __SIMPLE_REFLECT_COLUMN_STORE_HEADER__
+
+#include <array>
+#include <span>
+#include <tuple>
+#include <vector>
+#include <utility>
+#include <algorithm>
+
+#include "Reflect.hpp"
+
+NAMESPACE_BEGIN(NS_REFLECT)
+
+NAMESPACE_BEGIN(NS_DETAIL)
+
+// Built-in arrays can not be held in std::vector, they are stored as std::array.
+template<typename T>
+struct ColumnValue { using type = T; };
+
+template<typename T, std::size_t N>
+struct ColumnValue<T[N]> { using type = std::array<typename ColumnValue<T>::type, N>; };
+
+template<reflectable Cls, typename Subset>
+struct ColumnLayout;
+
+template<reflectable Cls, std::size_t ...Indices>
+struct ColumnLayout<Cls, member_subset<Cls, Indices...>>
+{
+	template<std::size_t Index>
+	using Member = std::remove_cv_t<typename InfoTupleElem<Cls, Index>::member_type>;
+
+	using Storage = std::tuple<std::vector<typename ColumnValue<Member<Indices>>::type>...>;
+
+	inline static constexpr const std::size_t indices[] = { Indices..., 0 };
+
+	// position of member Index in Storage
+	template<std::size_t Index>
+	static constexpr std::size_t position() noexcept
+	{ return std::ranges::find(indices, Index) - std::ranges::begin(indices); }
+
+	template<std::size_t Index>
+	static auto& member_of(auto* obj) noexcept
+	{ return member_info<Cls, Index>().to_real_variable(obj); }
+
+	// built-in arrays can not be assigned, copy them element-wise
+	template<typename Dst, typename Src>
+	static void assign(Dst& dst, const Src& src)
+	{
+		if constexpr (std::is_array_v<Dst> || std::is_array_v<Src>)
+		{
+			for (std::size_t i = 0; i < std::size(src); ++i)
+				assign(dst[i], src[i]);
+		}
+		else
+			dst = src;
+	}
+
+	template<std::size_t Index>
+	static void push_member(Storage& storage, const Cls& obj)
+	{
+		auto& column = std::get<position<Index>()>(storage);
+		if constexpr (std::is_array_v<Member<Index>>)
+			assign(column.emplace_back(), member_of<Index>(&obj));
+		else
+			column.push_back(member_of<Index>(&obj));
+	}
+
+	static void push_back(Storage& storage, const Cls& obj)
+	{ (push_member<Indices>(storage, obj), ...); }
+
+	static void load(const Storage& storage, std::size_t row, Cls& obj)
+	{ (assign(member_of<Indices>(&obj), std::get<position<Indices>()>(storage)[row]), ...); }
+};
+
+NAMESPACE_END(NS_DETAIL)
+
+// Columnar (structure of arrays) storage of reflected data members of Cls,
+// each member is stored in its own contiguous std::vector, built-in array members as std::array.
+template<reflectable Cls>
+class column_store
+{
+	using Layout = NS_DETAIL::ColumnLayout<Cls, select_members<Cls, data_members>>;
+public:
+	using value_type = Cls;
+	using size_type  = std::size_t;
+
+	column_store() = default;
+
+	explicit column_store(std::span<const Cls> data)
+	{
+		reserve(data.size());
+		for (const auto& obj : data)
+			push_back(obj);
+	}
+
+	void push_back(const Cls& obj)
+	{
+		Layout::push_back(columns, obj);
+		++count;
+	}
+
+	// Assemble row into a full object, Cls has to be default constructible
+	Cls load(size_type row) const
+	{
+		Cls obj{};
+		Layout::load(columns, row, obj);
+		return obj;
+	}
+
+	// Contiguous values of data member Name
+	template<StaticString Name>
+		requires (member_index<Cls, Name>() < member_count_v<Cls>) && NS_DETAIL::InfoTupleElem<Cls, member_index<Cls, Name>()>::is_object_pointer
+	auto column() noexcept
+	{
+		constexpr std::size_t idx = member_index<Cls, Name>();
+		return std::span{ std::get<Layout::template position<idx>()>(columns) };
+	}
+
+	template<StaticString Name>
+		requires (member_index<Cls, Name>() < member_count_v<Cls>) && NS_DETAIL::InfoTupleElem<Cls, member_index<Cls, Name>()>::is_object_pointer
+	auto column() const noexcept
+	{
+		constexpr std::size_t idx = member_index<Cls, Name>();
+		return std::span{ std::as_const(std::get<Layout::template position<idx>()>(columns)) };
+	}
+
+	size_type size()  const noexcept { return count; }
+	bool      empty() const noexcept { return count == 0; }
+
+	void reserve(size_type n)
+	{ std::apply([n](auto& ...column) { (column.reserve(n), ...); }, columns); }
+
+	void clear() noexcept
+	{
+		std::apply([](auto& ...column) { (column.clear(), ...); }, columns);
+		count = 0;
+	}
+
+private:
+	typename Layout::Storage columns;
+	size_type count = 0;
+};
+
+NAMESPACE_END(NS_REFLECT)
+
+#endif //! __SIMPLE_REFLECT_COLUMN_STORE_HEADER__
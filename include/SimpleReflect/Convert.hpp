@@ -0,0 +1,217 @@
+#ifndef __SIMPLE_REFLECT_CONVERT_HEADER__
+#define __SIMPLE_REFLECT_CONVERT_HEADER__
+
+#include <array>
+#include <memory>
+#include <cstring>
+#include <utility>
+#include <algorithm>
+
+#include "Reflect.hpp"
+
+NAMESPACE_BEGIN(NS_REFLECT)
+
+// What convert and assign do with data members that have no member of the same name on the other side.
+enum class unmatched_members
+{
+	ignore,       // keep their values
+	error_target, // compile error for unmatched members of the destination
+	error_any     // compile error for unmatched members of either side
+};
+
+NAMESPACE_BEGIN(NS_DETAIL)
+
+template<reflectable Cls>
+inline constexpr auto convert_names_v = member_names<Cls, std::array<StringView, member_count_v<Cls>>>();
+
+template<reflectable Cls, std::size_t ...Indices>
+constexpr auto data_member_flags(std::index_sequence<Indices...>) noexcept
+{ return std::array<bool, sizeof...(Indices)>{ InfoTupleElem<Cls, Indices>::is_object_pointer... }; }
+
+// Index of the data member of Cls named name, member_count_v<Cls> if there is none.
+template<reflectable Cls>
+constexpr std::size_t find_data_member(StringView name) noexcept
+{
+	constexpr auto is_data = data_member_flags<Cls>(std::make_index_sequence<member_count_v<Cls>>{});
+	for (std::size_t i = 0; i < member_count_v<Cls>; ++i) {
+		if (is_data[i] && convert_names_v<Cls>[i] == name)
+			return i;
+	}
+	return member_count_v<Cls>;
+}
+
+// Index of the member of From that is copied into member Index of To.
+template<reflectable To, reflectable From, std::size_t Index>
+inline constexpr std::size_t convert_source_v = InfoTupleElem<To, Index>::is_object_pointer
+	? find_data_member<From>(InfoTupleElem<To, Index>::name)
+	: member_count_v<From>;
+
+template<reflectable Cls, std::size_t Index>
+inline constexpr auto member_static_name_v = StaticString<InfoTupleElem<Cls, Index>::name.size(), typename InfoTupleElem<Cls, Index>::char_type>{
+	InfoTupleElem<Cls, Index>::name
+};
+
+template<typename Cls, auto Name>
+struct unmatched_member
+{
+	static_assert(!sizeof(Cls*), "Reflect::convert: member Name of Cls has no counterpart");
+};
+
+template<typename To, typename From>
+inline constexpr bool trivially_copied_v = std::is_same_v<std::remove_cv_t<To>, std::remove_cv_t<From>> && std::is_trivially_copyable_v<To>;
+
+template<typename Cls, std::size_t Index, typename Obj>
+constexpr auto& convert_member(Obj& obj) noexcept
+{ return member_info<Cls, Index>().to_real_variable(std::addressof(obj)); }
+
+template<typename Obj, typename Member>
+std::size_t member_offset(const Obj& obj, const Member& member) noexcept
+{ return reinterpret_cast<const std::byte*>(std::addressof(member)) - reinterpret_cast<const std::byte*>(std::addressof(obj)); }
+
+template<unmatched_members Policy, typename To, typename From>
+constexpr void assign_value(To& to, From&& from);
+
+template<unmatched_members Policy, reflectable To, typename From, std::size_t ...Indices>
+constexpr void assign_members(To& to, From&& from, std::index_sequence<Indices...>)
+{
+	using FromCls = std::remove_cvref_t<From>;
+	constexpr bool move = !std::is_lvalue_reference_v<From> && !std::is_const_v<std::remove_reference_t<From>>;
+
+	// Every member would be assigned from itself, which leaves moved members unspecified.
+	if constexpr (std::is_same_v<std::remove_cv_t<To>, FromCls>)
+	{
+		if (static_cast<const void*>(std::addressof(to)) == static_cast<const void*>(std::addressof(from)))
+			return;
+	}
+
+	const auto assign_one = [&]<std::size_t Index>(std::integral_constant<std::size_t, Index>) {
+		constexpr std::size_t source = convert_source_v<To, FromCls, Index>;
+		if constexpr (source < member_count_v<FromCls>)
+		{
+			auto& src = convert_member<FromCls, source>(from);
+			if constexpr (move)
+				assign_value<Policy>(convert_member<To, Index>(to), std::move(src));
+			else
+				assign_value<Policy>(convert_member<To, Index>(to), src);
+		}
+		else if constexpr (Policy != unmatched_members::ignore && InfoTupleElem<To, Index>::is_object_pointer)
+			(void)sizeof(unmatched_member<To, member_static_name_v<To, Index>>);
+	};
+
+	if constexpr (Policy == unmatched_members::error_any)
+	{
+		[]<std::size_t ...J>(std::index_sequence<J...>) {
+			([] {
+				if constexpr (InfoTupleElem<FromCls, J>::is_object_pointer && find_data_member<To>(InfoTupleElem<FromCls, J>::name) == member_count_v<To>)
+					(void)sizeof(unmatched_member<FromCls, member_static_name_v<FromCls, J>>);
+			}(), ...);
+		}(std::make_index_sequence<member_count_v<FromCls>>{});
+	}
+
+	// Members of the same trivially copyable type are copied by one memmove, if they are adjacent
+	// in both classes and in the same order. Offsets are constants after inlining, so is the check.
+	// memmove, because to and from may overlap when one is a member of the other.
+	constexpr bool trivial[] = {
+		(convert_source_v<To, FromCls, Indices> < member_count_v<FromCls> && trivially_copied_v<
+			typename InfoTupleElem<To, Indices>::member_type,
+			typename InfoTupleElem<FromCls, std::min(convert_source_v<To, FromCls, Indices>, member_count_v<FromCls> - 1)>::member_type
+		>)..., false
+	};
+	constexpr std::size_t trivial_count = (trivial[Indices] + ... + 0);
+
+	bool coalesced = false;
+	if constexpr (trivial_count > 1)
+	{
+		if (!std::is_constant_evaluated())
+		{
+			std::size_t to_begin = 0, from_begin = 0, to_end = 0, count = 0;
+			bool adjacent = true;
+			const auto extend = [&]<std::size_t Index>(std::integral_constant<std::size_t, Index>) {
+				if constexpr (trivial[Index])
+				{
+					const auto& dst = convert_member<To, Index>(to);
+					const auto to_offset   = member_offset(to, dst);
+					const auto from_offset = member_offset(from, convert_member<FromCls, convert_source_v<To, FromCls, Index>>(from));
+					if (count++ == 0)
+					{
+						to_begin = to_offset;
+						from_begin = from_offset;
+					}
+					else
+						adjacent &= to_offset == to_end && from_offset - from_begin == to_offset - to_begin;
+					to_end = to_offset + sizeof(dst);
+				}
+			};
+			(extend(std::integral_constant<std::size_t, Indices>{}), ...);
+
+			if (adjacent)
+			{
+				std::memmove(
+					reinterpret_cast<std::byte*>(std::addressof(to)) + to_begin,
+					reinterpret_cast<const std::byte*>(std::addressof(from)) + from_begin,
+					to_end - to_begin
+				);
+				coalesced = true;
+			}
+		}
+	}
+
+	([&] {
+		if (!(coalesced && trivial[Indices]))
+			assign_one(std::integral_constant<std::size_t, Indices>{});
+	}(), ...);
+}
+
+template<unmatched_members Policy, typename To, typename From>
+constexpr void assign_value(To& to, From&& from)
+{
+	using FromType = std::remove_cvref_t<From>;
+	if constexpr (std::is_same_v<std::remove_cv_t<To>, FromType> && std::is_assignable_v<To&, From&&>)
+		to = std::forward<From>(from);
+	else if constexpr (reflectable<To> && reflectable<FromType>)
+		assign_members<Policy>(to, std::forward<From>(from), std::make_index_sequence<member_count_v<To>>{});
+	else if constexpr (std::is_array_v<To> && std::is_array_v<FromType> && std::extent_v<To> == std::extent_v<FromType>)
+	{
+		for (std::size_t i = 0; i < std::extent_v<To>; ++i) {
+			if constexpr (std::is_lvalue_reference_v<From>)
+				assign_value<Policy>(to[i], from[i]);
+			else
+				assign_value<Policy>(to[i], std::move(from[i]));
+		}
+	}
+	else if constexpr (requires { static_cast<To>(std::forward<From>(from)); })
+		to = static_cast<To>(std::forward<From>(from));
+	else if constexpr (std::is_assignable_v<To&, From&&>)
+		to = std::forward<From>(from);
+	else
+		static_assert(!sizeof(To*), "Reflect::convert: members with the same name have inconvertible types");
+}
+
+NAMESPACE_END(NS_DETAIL)
+
+// Assign each reflected data member of to from the data member with the same name of from.
+// Members are moved if from is an rvalue. Members of different types are converted with static_cast,
+// nested reflected classes are assigned recursively.
+template<unmatched_members Policy = unmatched_members::ignore, reflectable To, typename From>
+	requires reflectable<std::remove_cvref_t<From>>
+constexpr void assign(To& to, From&& from)
+{
+	REFLECT_RECORD_ACCESS_ALL(To);
+	REFLECT_RECORD_ACCESS_ALL(From);
+	NS_DETAIL::assign_members<Policy>(to, std::forward<From>(from), std::make_index_sequence<member_count_v<To>>{});
+}
+
+// Create a To from the members of from with the same names, see assign.
+// Members of To that are not matched are value initialized.
+template<reflectable To, unmatched_members Policy = unmatched_members::ignore, typename From>
+	requires reflectable<std::remove_cvref_t<From>> && std::is_default_constructible_v<To>
+constexpr To convert(From&& from)
+{
+	To result{};
+	assign<Policy>(result, std::forward<From>(from));
+	return result;
+}
+
+NAMESPACE_END(NS_REFLECT)
+
+#endif //! __SIMPLE_REFLECT_CONVERT_HEADER__
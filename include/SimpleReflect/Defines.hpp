@@ -2,6 +2,7 @@
 #define __SIMPLE_REFLECT_DEFINES_HEADER__
 
 #include <string>
+#include <cstdint>
 #include <algorithm>
 #include <source_location>
 
@@ -35,6 +36,12 @@ NAMESPACE_BEGIN(NS_REFLECT)
 #endif
 #endif
 
+// Define to 1 to count accesses of reflected members through get_member, visit_member
+// and for_each_member, see Instrument.hpp. Compiles to nothing when 0.
+#ifndef REFLECT_INSTRUMENT_ACCESS
+#define REFLECT_INSTRUMENT_ACCESS 0
+#endif
+
 #if defined(USE_WCHAR) && USE_WCHAR
 
 #define TXT_IMPL(x) L ## x
@@ -156,6 +163,56 @@ struct type_name
 template<typename T>
 inline constexpr std::string_view type_name_v = type_name<T>::value;
 
+NAMESPACE_BEGIN(NS_DETAIL)
+
+constexpr bool is_identifier_char(char c) noexcept
+{
+	return c == '_' || (c >= '0' && c <= '9') || (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z');
+}
+
+// 64-bit FNV-1a of a type name. Whitespace and the "class ", "struct ", "union ", "enum "
+// keywords (which MSVC puts before type names) are skipped, so spelling differences of
+// the same type hash to the same value. 0 is never returned.
+constexpr std::uint64_t type_name_hash(std::string_view name) noexcept
+{
+	constexpr std::string_view keywords[] = { "class ", "struct ", "union ", "enum " };
+
+	std::uint64_t hash = 0xcbf29ce484222325ull;
+	for (std::size_t i = 0; i < name.size(); ++i)
+	{
+		if (i == 0 || !is_identifier_char(name[i - 1]))
+		{
+			for (auto keyword : keywords) {
+				if (name.substr(i).starts_with(keyword))
+				{
+					i += keyword.size();
+					break;
+				}
+			}
+			if (i >= name.size())
+				break;
+		}
+		if (name[i] == ' ')
+			continue;
+		hash ^= static_cast<unsigned char>(name[i]);
+		hash *= 0x100000001b3ull;
+	}
+	return hash == 0 ? 1 : hash;
+}
+
+NAMESPACE_END(NS_DETAIL)
+
+// Compile time type identifier, stable across translation units and builds
+// of the same compiler. Does not depend on RTTI.
+template<typename T>
+struct type_id
+{
+	inline static constexpr const std::uint64_t value = NS_DETAIL::type_name_hash(type_name_v<T>);
+};
+
+template<typename T>
+inline constexpr std::uint64_t type_id_v = type_id<T>::value;
+
 NAMESPACE_END(NS_REFLECT)
 
 #endif
@@ -0,0 +1,423 @@
+#ifndef __SIMPLE_REFLECT_ENUM_MAP_HEADER__
+#define __SIMPLE_REFLECT_ENUM_MAP_HEADER__
+
+#include <array>
+#include <bit>
+#include <limits>
+#include <cstdint>
+#include <utility>
+#include <iterator>
+#include <stdexcept>
+#include <concepts>
+#include <type_traits>
+#include <initializer_list>
+
+#include "Enums.hpp"
+
+NAMESPACE_BEGIN(NS_REFLECT)
+NAMESPACE_BEGIN(NS_ENUMS)
+
+NAMESPACE_BEGIN(NS_DETAIL)
+
+inline constexpr std::size_t enum_npos = (std::size_t)-1;
+
+// Smallest unsigned type that can hold [0, N], N itself marks a missing value.
+template<std::size_t N>
+using EnumSlot = std::conditional_t<(N < std::numeric_limits<std::uint8_t>::max()), std::uint8_t,
+	std::conditional_t<(N < std::numeric_limits<std::uint16_t>::max()), std::uint16_t, std::uint32_t>>;
+
+// Maps reflected values of Enum to dense indices in [0, size), in order of enum_values_v.
+//  - contiguous values: index is the offset from the first value.
+//  - flags: 0 and each single bit is looked up by bit position.
+//  - otherwise: a table covering [first value, last value].
+template<typename Enum>
+struct EnumIndex
+{
+	using Unsigned = std::make_unsigned_t<std::underlying_type_t<Enum>>;
+
+	inline static constexpr const auto& values = enum_values_v<Enum>;
+	inline static constexpr const std::size_t size = values.size();
+
+	inline static constexpr const Unsigned first = size == 0 ? 0 : static_cast<Unsigned>(values.front());
+	// size_t, so that the range of a full uint8_t enum (256) does not wrap to 0
+	inline static constexpr const std::size_t range = size == 0 ? 0 : std::size_t{ static_cast<Unsigned>(static_cast<Unsigned>(values.back()) - first) } + 1;
+
+	inline static constexpr const bool is_contiguous = range == size;
+
+	using Slot = EnumSlot<size>;
+
+	static constexpr auto make_table() noexcept
+	{
+		if constexpr (is_contiguous)
+			return std::array<Slot, 0>{};
+		else if constexpr (is_flags_v<Enum>)
+		{
+			// slot 0 is value 0, slot n + 1 is bit n
+			std::array<Slot, enum_size<Enum>()> table{};
+			table.fill(static_cast<Slot>(size));
+			for (std::size_t i = 0; i < size; ++i) {
+				const auto bits = static_cast<Unsigned>(values[i]);
+				table[bits == 0 ? 0 : std::countr_zero(bits) + 1] = static_cast<Slot>(i);
+			}
+			return table;
+		}
+		else
+		{
+			std::array<Slot, range> table{};
+			table.fill(static_cast<Slot>(size));
+			for (std::size_t i = 0; i < size; ++i)
+				table[static_cast<Unsigned>(static_cast<Unsigned>(values[i]) - first)] = static_cast<Slot>(i);
+			return table;
+		}
+	}
+
+	inline static constexpr const auto table = make_table();
+
+	// enum_npos if v is not a reflected value of Enum.
+	static constexpr std::size_t index_of(Enum v) noexcept
+	{
+		const auto bits = static_cast<Unsigned>(v);
+		if constexpr (is_contiguous)
+		{
+			const auto offset = static_cast<Unsigned>(bits - first);
+			return offset < range ? offset : enum_npos;
+		}
+		else
+		{
+			std::size_t slot;
+			if constexpr (is_flags_v<Enum>)
+			{
+				if (bits & (bits - 1))
+					return enum_npos;
+				slot = table[bits == 0 ? 0 : std::countr_zero(bits) + 1];
+			}
+			else
+			{
+				const auto offset = static_cast<Unsigned>(bits - first);
+				if (offset >= range)
+					return enum_npos;
+				slot = table[offset];
+			}
+			return slot == size ? enum_npos : slot;
+		}
+	}
+};
+
+// Fixed size bit set that can find the next set bit.
+template<std::size_t N>
+struct EnumBits
+{
+	inline static constexpr const std::size_t word_bits = 64;
+
+	std::array<std::uint64_t, (N + word_bits - 1) / word_bits> words{};
+
+	constexpr bool test(std::size_t i) const noexcept
+	{ return (words[i / word_bits] >> (i % word_bits)) & 1; }
+
+	// returns whether the bit was changed
+	constexpr bool set(std::size_t i) noexcept
+	{
+		const auto mask = std::uint64_t{ 1 } << (i % word_bits);
+		const bool changed = !(words[i / word_bits] & mask);
+		words[i / word_bits] |= mask;
+		return changed;
+	}
+
+	constexpr bool reset(std::size_t i) noexcept
+	{
+		const auto mask = std::uint64_t{ 1 } << (i % word_bits);
+		const bool changed = words[i / word_bits] & mask;
+		words[i / word_bits] &= ~mask;
+		return changed;
+	}
+
+	constexpr std::size_t count() const noexcept
+	{
+		std::size_t result = 0;
+		for (auto word : words)
+			result += std::popcount(word);
+		return result;
+	}
+
+	// Index of the first set bit at or after i, N if there is none.
+	constexpr std::size_t next(std::size_t i) const noexcept
+	{
+		for (std::size_t w = i / word_bits; w < words.size(); ++w)
+		{
+			auto word = words[w];
+			if (w == i / word_bits)
+				word &= ~std::uint64_t{ 0 } << (i % word_bits);
+			if (word != 0)
+				return w * word_bits + std::countr_zero(word);
+		}
+		return N;
+	}
+
+	constexpr bool operator==(const EnumBits&) const noexcept = default;
+};
+
+// Forward iterator over set bits of an EnumBits, Deref turns an index into the value type.
+template<typename Owner, typename Deref>
+class EnumBitsIterator
+{
+public:
+	using iterator_concept  = std::forward_iterator_tag;
+	using iterator_category = std::input_iterator_tag;
+	using difference_type   = std::ptrdiff_t;
+	using value_type        = std::remove_cvref_t<std::invoke_result_t<Deref, Owner*, std::size_t>>;
+	using reference         = std::invoke_result_t<Deref, Owner*, std::size_t>;
+
+	constexpr EnumBitsIterator() noexcept = default;
+	constexpr EnumBitsIterator(Owner* owner, std::size_t index) noexcept
+		: owner{ owner }, index{ index } {}
+
+	constexpr reference operator*() const noexcept
+	{ return Deref{}(owner, index); }
+
+	constexpr EnumBitsIterator& operator++() noexcept
+	{
+		index = owner->bits.next(index + 1);
+		return *this;
+	}
+
+	constexpr EnumBitsIterator operator++(int) noexcept
+	{
+		auto copy = *this;
+		++*this;
+		return copy;
+	}
+
+	constexpr bool operator==(const EnumBitsIterator& other) const noexcept
+	{ return index == other.index; }
+
+private:
+	Owner* owner = nullptr;
+	std::size_t index = 0;
+};
+
+NAMESPACE_END(NS_DETAIL)
+
+// A set of reflected values of Enum, stored as one bit per value.
+// Values that are not reflected can not be inserted.
+template<typename Enum>
+	requires std::is_enum_v<Enum>
+class enum_set
+{
+	using Index = NS_DETAIL::EnumIndex<Enum>;
+
+	struct Deref
+	{
+		constexpr const Entry<Enum>& operator()(const enum_set*, std::size_t index) const noexcept
+		{ return NS_DETAIL::entries_v<Enum>[index]; }
+	};
+
+	template<typename, typename>
+	friend class NS_DETAIL::EnumBitsIterator;
+public:
+	using key_type   = Enum;
+	using size_type  = std::size_t;
+	using iterator       = NS_DETAIL::EnumBitsIterator<const enum_set, Deref>;
+	using const_iterator = iterator;
+
+	constexpr enum_set() noexcept = default;
+
+	constexpr enum_set(std::initializer_list<Enum> values) noexcept
+	{
+		for (auto v : values)
+			insert(v);
+	}
+
+	// Returns whether v was inserted, false if it's already in the set or not reflected.
+	constexpr bool insert(Enum v) noexcept
+	{
+		const auto idx = Index::index_of(v);
+		return idx != NS_DETAIL::enum_npos && bits.set(idx);
+	}
+
+	constexpr bool erase(Enum v) noexcept
+	{
+		const auto idx = Index::index_of(v);
+		return idx != NS_DETAIL::enum_npos && bits.reset(idx);
+	}
+
+	constexpr bool contains(Enum v) const noexcept
+	{
+		const auto idx = Index::index_of(v);
+		return idx != NS_DETAIL::enum_npos && bits.test(idx);
+	}
+
+	constexpr void clear() noexcept { bits = {}; }
+
+	constexpr size_type size()  const noexcept { return bits.count(); }
+	constexpr bool      empty() const noexcept { return bits == decltype(bits){}; }
+
+	// Number of reflected values of Enum.
+	static constexpr size_type max_size() noexcept { return Index::size; }
+
+	// Iterates in order of reflected values, yields Entry<Enum> (name and value).
+	constexpr iterator begin() const noexcept { return { this, bits.next(0) }; }
+	constexpr iterator end()   const noexcept { return { this, Index::size }; }
+
+	constexpr bool operator==(const enum_set&) const noexcept = default;
+
+private:
+	NS_DETAIL::EnumBits<Index::size> bits;
+};
+
+// One element of an enum_map, yielded by iteration.
+template<typename Enum, typename Ref>
+struct enum_map_entry
+{
+	std::string_view name;
+	Enum value;
+	Ref mapped;
+};
+
+// A map from reflected values of Enum to V, stored in a std::array indexed by
+// the dense index of each value. No hashing is done on lookup.
+// Intended to replace std::unordered_map<Enum, V> for small hot tables.
+template<typename Enum, std::default_initializable V>
+	requires std::is_enum_v<Enum>
+class enum_map
+{
+	using Index = NS_DETAIL::EnumIndex<Enum>;
+
+	template<typename Map, typename Ref>
+	struct Deref
+	{
+		constexpr enum_map_entry<Enum, Ref> operator()(Map* map, std::size_t index) const noexcept
+		{
+			const auto& entry = NS_DETAIL::entries_v<Enum>[index];
+			return { entry.name, entry.value, map->values[index] };
+		}
+	};
+
+	template<typename, typename>
+	friend class NS_DETAIL::EnumBitsIterator;
+public:
+	using key_type    = Enum;
+	using mapped_type = V;
+	using size_type   = std::size_t;
+	using iterator       = NS_DETAIL::EnumBitsIterator<enum_map, Deref<enum_map, V&>>;
+	using const_iterator = NS_DETAIL::EnumBitsIterator<const enum_map, Deref<const enum_map, const V&>>;
+
+	constexpr enum_map() = default;
+
+	constexpr enum_map(std::initializer_list<std::pair<Enum, V>> init)
+	{
+		for (const auto& [ key, value ] : init)
+			insert_or_assign(key, value);
+	}
+
+	// nullptr if key is not in the map.
+	constexpr V* find(Enum key) noexcept
+	{
+		const auto idx = Index::index_of(key);
+		return idx != NS_DETAIL::enum_npos && bits.test(idx) ? &values[idx] : nullptr;
+	}
+
+	constexpr const V* find(Enum key) const noexcept
+	{
+		const auto idx = Index::index_of(key);
+		return idx != NS_DETAIL::enum_npos && bits.test(idx) ? &values[idx] : nullptr;
+	}
+
+	constexpr bool contains(Enum key) const noexcept
+	{ return find(key) != nullptr; }
+
+	// Insert value for key if not exists, returns the position of key and whether it was inserted.
+	// Returns { end(), false } if key is not a reflected value of Enum.
+	template<typename ...Args>
+	constexpr std::pair<iterator, bool> emplace(Enum key, Args&& ...args)
+	{
+		const auto idx = Index::index_of(key);
+		if (idx == NS_DETAIL::enum_npos)
+			return { end(), false };
+		if (!bits.set(idx))
+			return { iterator{ this, idx }, false };
+		values[idx] = V(std::forward<Args>(args)...);
+		return { iterator{ this, idx }, true };
+	}
+
+	// Insert or assign value for key, returns the position of key and whether it was inserted.
+	// Returns { end(), false } if key is not a reflected value of Enum.
+	template<typename U>
+	constexpr std::pair<iterator, bool> insert_or_assign(Enum key, U&& value)
+	{
+		const auto idx = Index::index_of(key);
+		if (idx == NS_DETAIL::enum_npos)
+			return { end(), false };
+		const bool inserted = bits.set(idx);
+		values[idx] = std::forward<U>(value);
+		return { iterator{ this, idx }, inserted };
+	}
+
+	// Value for key, default constructed if not exists.
+	// Throws std::out_of_range if key is not a reflected value of Enum.
+	constexpr V& operator[](Enum key)
+	{
+		const auto idx = checked_index(key);
+		bits.set(idx);
+		return values[idx];
+	}
+
+	// Value for key, throws std::out_of_range if key is not in the map.
+	constexpr V& at(Enum key)
+	{
+		if (auto* value = find(key))
+			return *value;
+		throw std::out_of_range("enum_map::at: key is not in the map");
+	}
+
+	constexpr const V& at(Enum key) const
+	{
+		if (auto* value = find(key))
+			return *value;
+		throw std::out_of_range("enum_map::at: key is not in the map");
+	}
+
+	constexpr bool erase(Enum key) noexcept
+	{
+		const auto idx = Index::index_of(key);
+		if (idx == NS_DETAIL::enum_npos || !bits.reset(idx))
+			return false;
+		values[idx] = V{};
+		return true;
+	}
+
+	constexpr void clear() noexcept
+	{
+		bits = {};
+		values.fill(V{});
+	}
+
+	constexpr size_type size()  const noexcept { return bits.count(); }
+	constexpr bool      empty() const noexcept { return size() == 0; }
+
+	// Number of reflected values of Enum.
+	static constexpr size_type max_size() noexcept { return Index::size; }
+
+	// Iterates in order of reflected values, yields enum_map_entry{ name, value, V& }:
+	// for (auto [ name, value, mapped ] : map)
+	constexpr iterator       begin()       noexcept { return { this, bits.next(0) }; }
+	constexpr iterator       end()         noexcept { return { this, Index::size }; }
+	constexpr const_iterator begin() const noexcept { return { this, bits.next(0) }; }
+	constexpr const_iterator end()   const noexcept { return { this, Index::size }; }
+
+private:
+	static constexpr std::size_t checked_index(Enum key)
+	{
+		const auto idx = Index::index_of(key);
+		if (idx == NS_DETAIL::enum_npos)
+			throw std::out_of_range("enum_map: key is not a reflected value");
+		return idx;
+	}
+
+	NS_DETAIL::EnumBits<Index::size> bits;
+	std::array<V, Index::size> values{};
+};
+
+NAMESPACE_END(NS_ENUMS)
+NAMESPACE_END(NS_REFLECT)
+
+#endif //! __SIMPLE_REFLECT_ENUM_MAP_HEADER__
@@ -5,12 +5,17 @@
 
 #include <array>
 #include <algorithm>
+#include <bit>
+#include <span>
+#include <limits>
+#include <optional>
+#include <type_traits>
 
 #ifndef NS_ENUMS
 #define NS_ENUMS Enums
 #endif
 
-#ifdef USE_WCHAR
+#if USE_WCHAR
 #warning "Enum reflection depends on std::source_location, which can not return wchar_t string"
 #endif
 
@@ -24,15 +29,51 @@ struct ConfigBase
 	constexpr static const std::size_t min = MIN;
 };
 
+// Inherit this to mark an enum as bit flags. Only 0 and single bit values
+// are scanned, max and min are ignored.
+struct FlagsConfigBase : ConfigBase<>
+{
+	constexpr static const bool is_flags = true;
+};
+
 template<typename Enum>
 struct ReflectConfig : ConfigBase<> {};
 
+template<typename Enum>
+struct is_flags : std::false_type {};
+
+template<typename Enum>
+	requires requires { ReflectConfig<Enum>::is_flags; }
+struct is_flags<Enum> : std::bool_constant<ReflectConfig<Enum>::is_flags> {};
+
+template<typename Enum>
+inline constexpr bool is_flags_v = is_flags<Enum>::value;
+
+// Set `short_name = true` in ReflectConfig to drop the qualification of names,
+// e.g. "Red" instead of "Colors::Red".
+template<typename Enum>
+struct use_short_name : std::false_type {};
+
+template<typename Enum>
+	requires requires { ReflectConfig<Enum>::short_name; }
+struct use_short_name<Enum> : std::bool_constant<ReflectConfig<Enum>::short_name> {};
+
+template<typename Enum>
+inline constexpr bool use_short_name_v = use_short_name<Enum>::value;
+
 NAMESPACE_BEGIN(NS_DETAIL)
+
+template<typename Enum>
+using flags_underlying_t = std::make_unsigned_t<std::underlying_type_t<Enum>>;
+
 template<typename Enum>
 constexpr std::size_t enum_size() noexcept
 {
 	using Config = ReflectConfig<Enum>;
-	return Config::max - Config::min + 1;
+	if constexpr (is_flags_v<Enum>)
+		return std::numeric_limits<flags_underlying_t<Enum>>::digits + 1;
+	else
+		return Config::max - Config::min + 1;
 }
 
 enum class EnumNameHelper { VOID };
@@ -54,45 +95,42 @@ template<typename Enum, Enum V>
 inline constexpr std::string_view wrapped_enum_value_name() noexcept
 { return std::source_location::current().function_name(); }
 
-template<typename Enum>
-inline constexpr std::size_t wrapped_enum_value_name_prefix_length() noexcept
-{
-	constexpr auto prefix_len = wrapped_enum_value_name<EnumNameHelper, EnumNameHelper::VOID>()
-		.find(enum_value_name<EnumNameHelper, EnumNameHelper::VOID>());
-	constexpr auto real_prefix_len = prefix_len - (type_name_v<EnumNameHelper>.length() - type_name_v<Enum>.length());
-	return real_prefix_len;
-}
 inline constexpr std::size_t wrapped_enum_value_name_suffix_length() noexcept
 {
-	return wrapped_enum_value_name<EnumNameHelper, EnumNameHelper::VOID>().length()
-		- wrapped_enum_value_name_prefix_length<EnumNameHelper>()
-		- enum_value_name<EnumNameHelper, EnumNameHelper::VOID>().length();
+	constexpr auto wrapped_name = wrapped_enum_value_name<EnumNameHelper, EnumNameHelper::VOID>();
+	constexpr auto name = enum_value_name<EnumNameHelper, EnumNameHelper::VOID>();
+	return wrapped_name.length() - wrapped_name.rfind(name) - name.length();
 }
+
+// The value is always the last template argument, so only the suffix is fixed.
+// Type name may appear more than once before it (e.g. "[with Enum = X; Enum V = X::A]").
 template<typename Enum, Enum V>
 inline constexpr std::string_view enum_value_name() noexcept
 {
 	constexpr auto wrapped_name = wrapped_enum_value_name<Enum, V>();
-	constexpr auto prefix_length = wrapped_enum_value_name_prefix_length<Enum>();
-	constexpr auto suffix_length = wrapped_enum_value_name_suffix_length();
-	constexpr auto type_name_length = wrapped_name.length() - prefix_length - suffix_length;
-	return wrapped_name.substr(prefix_length, type_name_length);
+	constexpr auto end = wrapped_name.length() - wrapped_enum_value_name_suffix_length();
+	constexpr auto begin = wrapped_name.find_last_of(" ,", end - 1) + 1;
+	return wrapped_name.substr(begin, end - begin);
 }
 
 template<typename Enum, Enum V>
 consteval bool is_valid() noexcept
 {
 	constexpr std::string_view name{ enum_value_name<Enum, V>() };
-	if constexpr (name.find("(") != std::string_view::npos)
+	if constexpr (name.find_first_of("()") != std::string_view::npos)
 		return false;
 	else
 		return !name.empty();
 }
 
 template<typename Enum>
-consteval Enum get_enum_value(std::size_t v)
+constexpr Enum get_enum_value(std::size_t v)
 {
 	using Config = ReflectConfig<Enum>;
-	return static_cast<Enum>(Config::min + v);
+	if constexpr (is_flags_v<Enum>)
+		return static_cast<Enum>(v == 0 ? flags_underlying_t<Enum>{ 0 } : flags_underlying_t<Enum>{ 1 } << (v - 1));
+	else
+		return static_cast<Enum>(Config::min + v);
 }
 
 template<typename Enum, std::size_t... I>
@@ -136,11 +174,14 @@ inline constexpr auto enum_values_v = values<Enum>();
 
 NAMESPACE_END(NS_DETAIL)
 
+// name is a null-terminated string stored in a per enum name pool.
 template<typename Enum>
 struct Entry
 {
 	std::string_view name;
 	Enum value;
+
+	constexpr const char* c_str() const noexcept { return name.data(); }
 };
 
 template<typename Enum, std::size_t N>
@@ -148,15 +189,105 @@ using EntryArray = std::array<Entry<Enum>, N>;
 
 NAMESPACE_BEGIN(NS_DETAIL)
 
+template<typename Enum>
+constexpr std::string_view entry_name(std::string_view name) noexcept
+{
+	if constexpr (use_short_name_v<Enum>)
+	{
+		const auto pos = name.rfind(':');
+		return pos == std::string_view::npos ? name : name.substr(pos + 1);
+	}
+	else
+		return name;
+}
+
+// These views point into function signatures, only used during constant evaluation
+// so that the signatures themselves are not kept in the binary.
+template<typename Enum, std::size_t... I>
+constexpr auto raw_entry_names(std::index_sequence<I...>) noexcept
+{
+	return std::array<std::string_view, sizeof...(I)>{
+		entry_name<Enum>(enum_value_name<Enum, enum_values_v<Enum>[I]>())...
+	};
+}
+
+template<typename Enum>
+inline constexpr auto raw_entry_names_v = raw_entry_names<Enum>(
+	std::make_index_sequence<enum_values_v<Enum>.size()>{}
+);
+
+// Index of the longest name that ends with names[i], which is i itself if there is none.
+// A name that is a suffix of another one shares its storage (and its null terminator).
+template<std::size_t N>
+constexpr std::size_t name_owner(const std::array<std::string_view, N>& names, std::size_t i) noexcept
+{
+	std::size_t owner = i;
+	for (std::size_t j = 0; j < N; ++j) {
+		if (names[j].size() > names[owner].size() && names[j].ends_with(names[i]))
+			owner = j;
+	}
+	return owner;
+}
+
+// Offset of each name in the pool, the last element is the size of pool.
+template<typename Enum>
+constexpr auto name_offsets() noexcept
+{
+	constexpr const auto& names = raw_entry_names_v<Enum>;
+	std::array<std::size_t, names.size() + 1> offsets{};
+
+	std::size_t size = 0;
+	for (std::size_t i = 0; i < names.size(); ++i) {
+		if (name_owner(names, i) != i)
+			continue;
+		offsets[i] = size;
+		size += names[i].size() + 1;
+	}
+	for (std::size_t i = 0; i < names.size(); ++i) {
+		const auto owner = name_owner(names, i);
+		if (owner != i)
+			offsets[i] = offsets[owner] + names[owner].size() - names[i].size();
+	}
+	offsets.back() = size;
+	return offsets;
+}
+
+template<typename Enum>
+inline constexpr auto name_offsets_v = name_offsets<Enum>();
+
+template<typename Enum>
+constexpr auto name_pool() noexcept
+{
+	constexpr const auto& names   = raw_entry_names_v<Enum>;
+	constexpr const auto& offsets = name_offsets_v<Enum>;
+
+	std::array<char, offsets.back()> pool{};
+	for (std::size_t i = 0; i < names.size(); ++i)
+		std::ranges::copy(names[i], pool.begin() + offsets[i]);
+	return pool;
+}
+
+// All names of Enum, separated by '\0'.
+template<typename Enum>
+inline constexpr auto name_pool_v = name_pool<Enum>();
+
 template<typename Enum, std::size_t... I>
 constexpr auto entries_impl(std::index_sequence<I...>) noexcept
 	-> EntryArray<Enum, enum_values_v<Enum>.size()>
 {
+	constexpr const auto& pool    = name_pool_v<Enum>;
+	constexpr const auto& offsets = name_offsets_v<Enum>;
+	constexpr const auto& names   = raw_entry_names_v<Enum>;
 	return EntryArray<Enum, enum_values_v<Enum>.size()>{
-		{{ enum_value_name<Enum, enum_values_v<Enum>[I]>(), enum_values_v<Enum>[I] }...}
+		{{ std::string_view{ pool.data() + offsets[I], names[I].size() }, enum_values_v<Enum>[I] }...}
 	};
 }
 
+template<typename Enum>
+inline constexpr auto entries_v = entries_impl<Enum>(
+	std::make_index_sequence<enum_values_v<Enum>.size()>{}
+);
+
 NAMESPACE_END(NS_DETAIL)
 
 template<typename Enum>
@@ -171,18 +302,130 @@ template<typename Enum>
 constexpr auto entries() noexcept
 	-> EntryArray<Enum, NS_DETAIL::enum_values_v<Enum>.size()>
 {
-	using Idx = std::make_index_sequence<NS_DETAIL::enum_values_v<Enum>.size()>;
-	return NS_DETAIL::entries_impl<Enum>(Idx{});
+	return NS_DETAIL::entries_v<Enum>;
 }
+
+// The returned view is null-terminated, .data() can be passed to C APIs directly.
 template<typename Enum>
 constexpr std::string_view to_string(Enum v) noexcept
 {
-	for (const auto& [ name, value ]: entries<Enum>()) {
+	for (const auto& [ name, value ]: NS_DETAIL::entries_v<Enum>) {
 		if (v == value) return name;
 	}
 	return {};
 }
 
+// Convert string to enum value, name must be exactly the same as to_string returns.
+template<typename Enum>
+	requires (!is_flags_v<Enum>)
+constexpr std::optional<Enum> from_string(std::string_view str) noexcept
+{
+	for (const auto& [ name, value ]: NS_DETAIL::entries_v<Enum>) {
+		if (str == name) return value;
+	}
+	return std::nullopt;
+}
+
+//////////////////////////////////////////////////////////////
+
+NAMESPACE_BEGIN(NS_DETAIL)
+
+// Name of each bit, indexed by bit position. Empty if that bit has no name.
+template<typename Enum>
+constexpr auto flag_names() noexcept
+{
+	std::array<std::string_view, enum_size<Enum>() - 1> names{};
+	for (const auto& [ name, value ] : entries_v<Enum>) {
+		const auto bits = static_cast<flags_underlying_t<Enum>>(value);
+		if (bits != 0) names[std::countr_zero(bits)] = name;
+	}
+	return names;
+}
+
+template<typename Enum>
+inline constexpr auto flag_names_v = flag_names<Enum>();
+
+template<typename Enum>
+constexpr Enum all_flags() noexcept
+{
+	flags_underlying_t<Enum> bits = 0;
+	for (const auto& [ name, value ] : entries_v<Enum>)
+		bits |= static_cast<flags_underlying_t<Enum>>(value);
+	return static_cast<Enum>(bits);
+}
+
+NAMESPACE_END(NS_DETAIL)
+
+// Bitwise OR of all reflected flags of Enum.
+template<typename Enum>
+	requires is_flags_v<Enum>
+inline constexpr Enum all_flags_v = NS_DETAIL::all_flags<Enum>();
+
+// Format a flags value as "A|B|C" into buffer, returns a view of written characters.
+// 0 is formatted as the name of zero value if there is one.
+// Returns an empty view if value contains unnamed bits or buffer is too small.
+template<typename Enum>
+	requires is_flags_v<Enum>
+constexpr std::string_view to_string(Enum v, std::span<char> buffer) noexcept
+{
+	using Underlying = NS_DETAIL::flags_underlying_t<Enum>;
+	constexpr const auto& names = NS_DETAIL::flag_names_v<Enum>;
+
+	auto bits = static_cast<Underlying>(v);
+	if (bits == 0)
+	{
+		const auto name = to_string(v);
+		if (name.size() > buffer.size())
+			return {};
+		std::ranges::copy(name, buffer.begin());
+		return { buffer.data(), name.size() };
+	}
+
+	std::size_t length = 0;
+	for (; bits != 0; bits &= bits - 1)
+	{
+		const auto name = names[std::countr_zero(bits)];
+		const std::size_t sep = length == 0 ? 0 : 1;
+		if (name.empty() || length + sep + name.size() > buffer.size())
+			return {};
+		if (sep != 0)
+			buffer[length] = '|';
+		std::ranges::copy(name, buffer.begin() + length + sep);
+		length += sep + name.size();
+	}
+	return { buffer.data(), length };
+}
+
+// Parse "A|B|C" into a flags value, each part must be a reflected name.
+template<typename Enum>
+	requires is_flags_v<Enum>
+constexpr std::optional<Enum> from_string(std::string_view str) noexcept
+{
+	using Underlying = NS_DETAIL::flags_underlying_t<Enum>;
+
+	Underlying bits = 0;
+	while (true)
+	{
+		const auto pos = str.find('|');
+		const auto part = str.substr(0, pos);
+		bool found = false;
+		for (const auto& [ name, value ] : NS_DETAIL::entries_v<Enum>) {
+			if (part == name)
+			{
+				bits |= static_cast<Underlying>(value);
+				found = true;
+				break;
+			}
+		}
+		if (!found)
+			return std::nullopt;
+		if (pos == std::string_view::npos)
+			break;
+		str.remove_prefix(pos + 1);
+	}
+	return static_cast<Enum>(bits);
+}
+
 NAMESPACE_END(NS_ENUMS)
 NAMESPACE_END(NS_REFLECT)
 
@@ -0,0 +1,244 @@
+#ifndef __SIMPLE_REFLECT_FORMAT_HEADER__
+#define __SIMPLE_REFLECT_FORMAT_HEADER__
+
+#include <format>
+#include <ranges>
+#include <utility>
+#include <algorithm>
+#include <string_view>
+
+#include "Reflect.hpp"
+#include "Enums.hpp"
+
+NAMESPACE_BEGIN(NS_REFLECT)
+
+NAMESPACE_BEGIN(NS_DETAIL)
+
+template<typename T, typename CharT>
+inline constexpr bool has_formatter_v = std::is_default_constructible_v<std::formatter<T, CharT>>;
+
+template<typename T, typename CharT>
+inline constexpr bool is_char_array_v = std::is_array_v<T> && std::is_same_v<std::remove_extent_t<T>, CharT>;
+
+template<typename T, typename CharT>
+constexpr bool formattable_member() noexcept;
+
+template<reflectable Cls, typename CharT, std::size_t ...Indices>
+constexpr bool formattable_members(std::index_sequence<Indices...>) noexcept
+{
+	return ((InfoTupleElem<Cls, Indices>::is_function_pointer ||
+		formattable_member<std::remove_cv_t<typename InfoTupleElem<Cls, Indices>::member_type>, CharT>()) && ...);
+}
+
+// Reflected classes, enums, character arrays, types with a std::formatter and ranges of those.
+template<typename T, typename CharT>
+constexpr bool formattable_member() noexcept
+{
+	if constexpr (reflectable<T>)
+		return formattable_members<T, CharT>(std::make_index_sequence<member_count_v<T>>{});
+	else if constexpr (std::is_enum_v<T> || is_char_array_v<T, CharT> || has_formatter_v<T, CharT>)
+		return true;
+	else if constexpr (std::ranges::input_range<const T>)
+		return formattable_member<std::remove_cvref_t<std::ranges::range_reference_t<const T>>, CharT>();
+	else
+		return false;
+}
+
+// "{name: " for the first data member, ", name: " for others, "name: " in pretty mode.
+template<reflectable Cls, std::size_t Index, bool First, bool Pretty>
+inline constexpr auto member_prefix_v = [] {
+	using Info  = InfoTupleElem<Cls, Index>;
+	using CharT = typename Info::char_type;
+	constexpr std::size_t separator = Pretty ? 0 : First ? 1 : 2;
+
+	StaticString<separator + Info::name.size() + 2, CharT> prefix{};
+	auto* out = prefix.data();
+	if constexpr (!Pretty && First)
+		*out++ = CharT('{');
+	else if constexpr (!Pretty)
+	{
+		*out++ = CharT(',');
+		*out++ = CharT(' ');
+	}
+	for (auto c : Info::name)
+		*out++ = c;
+	*out++ = CharT(':');
+	*out++ = CharT(' ');
+	*out = CharT();
+	return prefix;
+}();
+
+template<typename CharT, typename Context, typename SrcChar>
+void format_string(Context& ctx, std::basic_string_view<SrcChar> str)
+{
+	auto out = ctx.out();
+	if constexpr (std::is_same_v<CharT, SrcChar>)
+		out = std::ranges::copy(str, out).out;
+	else
+	{
+		for (auto c : str)
+			*out++ = static_cast<CharT>(c);
+	}
+	ctx.advance_to(out);
+}
+
+template<typename CharT, typename Context>
+void format_indent(Context& ctx, int depth)
+{
+	auto out = ctx.out();
+	for (int i = 0; i < depth * 4; ++i)
+		*out++ = CharT(' ');
+	ctx.advance_to(out);
+}
+
+template<typename CharT, typename Context, typename T>
+void format_value(Context& ctx, const T& value, int depth);
+
+// Formatters have to parse their spec before they can format, members are formatted as with "{}".
+template<typename T, typename CharT>
+std::formatter<T, CharT> default_formatter()
+{
+	std::formatter<T, CharT> formatter;
+	std::basic_format_parse_context<CharT> parse_ctx{ std::basic_string_view<CharT>{} };
+	parse_ctx.advance_to(formatter.parse(parse_ctx));
+	return formatter;
+}
+
+// depth < 0 is compact mode, otherwise the indentation level of the object in pretty mode.
+template<typename CharT, typename Context, reflectable Cls, std::size_t ...Indices>
+void format_object(Context& ctx, const Cls& obj, int depth, std::index_sequence<Indices...>)
+{
+	constexpr bool selected[] = { InfoTupleElem<Cls, Indices>::is_object_pointer..., false };
+	constexpr std::size_t first = std::ranges::find(selected, true) - std::ranges::begin(selected);
+	constexpr std::size_t last  = [&] {
+		std::size_t result = 0;
+		for (std::size_t i = 0; i < sizeof...(Indices); ++i) {
+			if (selected[i])
+				result = i;
+		}
+		return result;
+	}();
+
+	const auto member = [&]<std::size_t Index>(std::integral_constant<std::size_t, Index>) {
+		if constexpr (selected[Index])
+		{
+			using StringViewType = typename InfoTupleElem<Cls, Index>::string_view_type;
+			const auto& value = member_info<Cls, Index>().to_real_variable(&obj);
+			if (depth < 0)
+			{
+				format_string<CharT>(ctx, StringViewType{ member_prefix_v<Cls, Index, Index == first, false> });
+				format_value<CharT>(ctx, value, depth);
+			}
+			else
+			{
+				format_indent<CharT>(ctx, depth + 1);
+				format_string<CharT>(ctx, StringViewType{ member_prefix_v<Cls, Index, Index == first, true> });
+				format_value<CharT>(ctx, value, depth + 1);
+				format_string<CharT>(ctx, std::string_view{ Index == last ? "\n" : ",\n" });
+			}
+		}
+	};
+
+	REFLECT_RECORD_ACCESS_ALL(Cls);
+	if constexpr (first >= sizeof...(Indices))
+		format_string<CharT>(ctx, std::string_view{ "{}" });
+	else if (depth < 0)
+	{
+		(member(std::integral_constant<std::size_t, Indices>{}), ...);
+		format_string<CharT>(ctx, std::string_view{ "}" });
+	}
+	else
+	{
+		format_string<CharT>(ctx, std::string_view{ "{\n" });
+		(member(std::integral_constant<std::size_t, Indices>{}), ...);
+		format_indent<CharT>(ctx, depth);
+		format_string<CharT>(ctx, std::string_view{ "}" });
+	}
+}
+
+template<typename CharT, typename Context, typename Enum>
+void format_enum(Context& ctx, Enum value)
+{
+	std::string_view name;
+	char buffer[256];
+	if constexpr (NS_ENUMS::is_flags_v<Enum>)
+		name = NS_ENUMS::to_string(value, buffer);
+	else
+		name = NS_ENUMS::to_string(value);
+
+	if (!name.empty())
+		format_string<CharT>(ctx, name);
+	else
+	{
+		// unary plus promotes character types, values of enum : char are written as numbers too
+		using Number = decltype(+std::declval<std::underlying_type_t<Enum>>());
+		ctx.advance_to(default_formatter<Number, CharT>().format(static_cast<Number>(value), ctx));
+	}
+}
+
+template<typename CharT, typename Context, typename T>
+void format_value(Context& ctx, const T& value, int depth)
+{
+	if constexpr (reflectable<T>)
+		format_object<CharT>(ctx, value, depth, std::make_index_sequence<member_count_v<T>>{});
+	else if constexpr (std::is_enum_v<T>)
+		format_enum<CharT>(ctx, value);
+	else if constexpr (is_char_array_v<T, CharT>)
+		format_string<CharT>(ctx, std::basic_string_view<CharT>{ value, std::ranges::find(value, CharT()) });
+	else if constexpr (has_formatter_v<T, CharT>)
+		ctx.advance_to(default_formatter<T, CharT>().format(value, ctx));
+	else
+	{
+		format_string<CharT>(ctx, std::string_view{ "[" });
+		bool first = true;
+		for (const auto& element : value)
+		{
+			if (!std::exchange(first, false))
+				format_string<CharT>(ctx, std::string_view{ ", " });
+			format_value<CharT>(ctx, element, depth);
+		}
+		format_string<CharT>(ctx, std::string_view{ "]" });
+	}
+}
+
+NAMESPACE_END(NS_DETAIL)
+
+// Cls can be formatted by std::format if all its reflected data members can be.
+template<typename Cls, typename CharT = char>
+concept formattable_reflectable = reflectable<Cls> && NS_DETAIL::formattable_member<Cls, CharT>();
+
+NAMESPACE_END(NS_REFLECT)
+
+// Formats reflected data members of Cls, member functions are skipped.
+// "{}"  compact: {a: 1, b: {c: 2.5, d: Red}, s: text}
+// "{:p}" pretty: one member per line, nested objects indented by 4 spaces.
+// Enums are written by their reflected name, nested reflected classes and ranges recursively.
+template<NS_REFLECT::reflectable Cls, typename CharT>
+	requires NS_REFLECT::formattable_reflectable<Cls, CharT>
+struct std::formatter<Cls, CharT>
+{
+	bool pretty = false;
+
+	template<typename ParseContext>
+	constexpr auto parse(ParseContext& ctx)
+	{
+		auto it = ctx.begin();
+		if (it != ctx.end() && *it == CharT('p'))
+		{
+			pretty = true;
+			++it;
+		}
+		if (it != ctx.end() && *it != CharT('}'))
+			throw std::format_error("invalid format spec for reflected class, expected {} or {:p}");
+		return it;
+	}
+
+	template<typename FormatContext>
+	auto format(const Cls& obj, FormatContext& ctx) const
+	{
+		NS_REFLECT::NS_DETAIL::format_value<CharT>(ctx, obj, pretty ? 0 : -1);
+		return ctx.out();
+	}
+};
+
+#endif //! __SIMPLE_REFLECT_FORMAT_HEADER__
@@ -0,0 +1,183 @@
+#ifndef __SIMPLE_REFLECT_INSTRUMENT_HEADER__
+#define __SIMPLE_REFLECT_INSTRUMENT_HEADER__
+
+#include <string>
+
+#include "Reflect.hpp"
+
+#if REFLECT_INSTRUMENT_ACCESS
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+
+NAMESPACE_BEGIN(NS_REFLECT)
+
+NAMESPACE_BEGIN(NS_DETAIL)
+
+// Thread local counts are merged into global counters after this many accesses
+// of a class in a thread, and when the thread exits.
+inline constexpr std::uint32_t access_flush_period = 4096;
+
+// Node of a lock-free list of all classes that have been accessed.
+struct AccessCounterNode
+{
+	std::string_view type_name;
+	std::size_t count;
+	const std::atomic<std::uint64_t>* counters;
+	void (*append_name)(std::string& out, std::size_t index);
+	AccessCounterNode* next = nullptr;
+};
+
+inline std::atomic<AccessCounterNode*> access_counter_head{ nullptr };
+
+template<typename Cls>
+struct GlobalAccessCounters
+{
+	inline static constexpr const std::size_t count = member_count_v<Cls>;
+
+	static void append_name(std::string& out, std::size_t index)
+	{
+		static constexpr auto names = member_names<Cls, std::array<StringView, count>>();
+		for (auto c : names[index])
+			out.push_back(static_cast<char>(c));
+	}
+
+	std::array<std::atomic<std::uint64_t>, count> counters{};
+	AccessCounterNode node{ type_name_v<Cls>, count, counters.data(), &append_name };
+	std::atomic<bool> registered{ false };
+
+	void merge(std::array<std::uint64_t, count>& local) noexcept
+	{
+		for (std::size_t i = 0; i < count; ++i) {
+			if (local[i] != 0)
+				counters[i].fetch_add(local[i], std::memory_order_relaxed);
+			local[i] = 0;
+		}
+		if (!registered.load(std::memory_order_relaxed) && !registered.exchange(true, std::memory_order_acq_rel))
+		{
+			node.next = access_counter_head.load(std::memory_order_relaxed);
+			while (!access_counter_head.compare_exchange_weak(
+				node.next, &node, std::memory_order_release, std::memory_order_relaxed
+			));
+		}
+	}
+};
+
+template<typename Cls>
+inline GlobalAccessCounters<Cls> global_access_counters;
+
+// Node of the list of classes accessed by current thread.
+struct LocalAccessCountersBase
+{
+	LocalAccessCountersBase* next = nullptr;
+	bool linked = false;
+
+	virtual void flush() noexcept = 0;
+};
+
+inline thread_local LocalAccessCountersBase* local_access_counters_head = nullptr;
+
+template<typename Cls>
+struct LocalAccessCounters final : LocalAccessCountersBase
+{
+	std::array<std::uint64_t, member_count_v<Cls>> counters{};
+	std::uint32_t pending = 0;
+
+	~LocalAccessCounters()
+	{ flush(); }
+
+	void flush() noexcept override
+	{
+		if (pending == 0)
+			return;
+		global_access_counters<Cls>.merge(counters);
+		pending = 0;
+	}
+
+	void tick() noexcept
+	{
+		if (++pending >= access_flush_period)
+			flush();
+	}
+};
+
+template<typename Cls>
+LocalAccessCounters<Cls>& local_counters() noexcept
+{
+	thread_local LocalAccessCounters<Cls> local;
+	if (!local.linked)
+	{
+		local.linked = true;
+		local.next = local_access_counters_head;
+		local_access_counters_head = &local;
+	}
+	return local;
+}
+
+template<typename Cls>
+void record_access(std::size_t index) noexcept
+{
+	auto& local = local_counters<Cls>();
+	++local.counters[index];
+	local.tick();
+}
+
+template<typename Cls>
+void record_access_all() noexcept
+{
+	auto& local = local_counters<Cls>();
+	for (auto& counter : local.counters)
+		++counter;
+	local.tick();
+}
+
+NAMESPACE_END(NS_DETAIL)
+
+// Merge access counts of current thread into global counters.
+// Other threads merge periodically and when they exit.
+inline void flush_access_counters() noexcept
+{
+	for (auto* local = NS_DETAIL::local_access_counters_head; local; local = local->next)
+		local->flush();
+}
+
+// One line per reflected member of each class that has been accessed: "<type name>::<member name> <count>".
+// Members that were never accessed are listed with 0.
+// Counts of current thread are flushed first.
+inline std::string access_report()
+{
+	flush_access_counters();
+
+	std::string report;
+	for (auto* node = NS_DETAIL::access_counter_head.load(std::memory_order_acquire); node; node = node->next)
+	{
+		for (std::size_t i = 0; i < node->count; ++i)
+		{
+			report += node->type_name;
+			report += "::";
+			node->append_name(report, i);
+			report += ' ';
+			report += std::to_string(node->counters[i].load(std::memory_order_relaxed));
+			report += '\n';
+		}
+	}
+	return report;
+}
+
+NAMESPACE_END(NS_REFLECT)
+
+#else
+
+NAMESPACE_BEGIN(NS_REFLECT)
+
+inline void flush_access_counters() noexcept {}
+
+inline std::string access_report()
+{ return {}; }
+
+NAMESPACE_END(NS_REFLECT)
+
+#endif //! REFLECT_INSTRUMENT_ACCESS
+
+#endif //! __SIMPLE_REFLECT_INSTRUMENT_HEADER__
@@ -0,0 +1,176 @@
+#ifndef __SIMPLE_REFLECT_LAZY_VIEW_HEADER__
+#define __SIMPLE_REFLECT_LAZY_VIEW_HEADER__
+
+#include <optional>
+
+#include "Serialize.hpp"
+
+NAMESPACE_BEGIN(NS_REFLECT)
+
+// Lazy format:
+//   header:  offset (serialize_size_t) of each member that follows a variable sized member
+//   payload: the same as serialize(obj)
+// Offsets of members before the first variable sized member are known at compile time,
+// so for classes without strings or vectors the header is empty.
+
+NAMESPACE_BEGIN(NS_DETAIL)
+
+template<reflectable Cls>
+struct LazyLayout
+{
+	inline static constexpr const std::size_t npos = (std::size_t)-1;
+	inline static constexpr const std::size_t count = member_count_v<Cls>;
+
+	struct Table
+	{
+		// offset in payload, npos if it has to be read from header
+		std::array<std::size_t, count> offset;
+		// index in header, npos if offset is known at compile time
+		std::array<std::size_t, count> slot;
+		std::size_t header_count;
+	};
+
+	template<std::size_t ...Indices>
+	static constexpr Table make_table(std::index_sequence<Indices...>) noexcept
+	{
+		constexpr std::size_t sizes[] = { member_encoded_size<InfoTupleElem<Cls, Indices>>()..., 0 };
+		constexpr bool is_function[] = { InfoTupleElem<Cls, Indices>::is_function_pointer..., false };
+
+		Table table{};
+		std::size_t offset = 0;
+		bool variable = false;
+		for (std::size_t i = 0; i < count; ++i)
+		{
+			table.offset[i] = variable ? npos : offset;
+			table.slot[i]   = variable && !is_function[i] ? table.header_count++ : npos;
+
+			if (sizes[i] == variable_encoded_size)
+				variable = true;
+			else
+				offset += sizes[i];
+		}
+		return table;
+	}
+
+	inline static constexpr const Table table = make_table(std::make_index_sequence<count>{});
+	inline static constexpr const std::size_t header_size = table.header_count * sizeof(serialize_size_t);
+};
+
+template<typename Sink, reflectable Cls, std::size_t ...Indices>
+void serialize_lazy_impl(const Cls& obj, std::vector<std::byte>& out, std::index_sequence<Indices...>)
+{
+	using Layout = LazyLayout<Cls>;
+
+	const std::size_t header_begin  = out.size();
+	const std::size_t payload_begin = header_begin + Layout::header_size;
+	out.resize(payload_begin);
+
+	Sink sink{ out };
+	Encoder<Sink> encoder{ sink };
+	([&] {
+		using Info = InfoTupleElem<Cls, Indices>;
+		if constexpr (!Info::is_function_pointer)
+		{
+			if constexpr (Layout::table.slot[Indices] != Layout::npos)
+			{
+				const auto offset = static_cast<serialize_size_t>(out.size() - payload_begin);
+				std::memcpy(
+					out.data() + header_begin + Layout::table.slot[Indices] * sizeof(serialize_size_t),
+					&offset, sizeof(offset)
+				);
+			}
+			encoder.encode(member_info<Cls, Indices>().to_real_variable(&obj));
+		}
+	}(), ...);
+}
+
+NAMESPACE_END(NS_DETAIL)
+
+// Append obj to out in lazy format, which can be read by lazy_view.
+template<reflectable Cls>
+void serialize_lazy(const Cls& obj, std::vector<std::byte>& out)
+{
+	NS_DETAIL::serialize_lazy_impl<NS_DETAIL::VectorSink>(
+		obj, out, std::make_index_sequence<member_count_v<Cls>>{}
+	);
+}
+
+template<reflectable Cls>
+std::vector<std::byte> serialize_lazy(const Cls& obj)
+{
+	std::vector<std::byte> out;
+	serialize_lazy(obj, out);
+	return out;
+}
+
+// A view over a buffer written by serialize_lazy, members are only decoded when requested.
+// The buffer must outlive the view.
+template<reflectable Cls>
+class lazy_view
+{
+	using Layout = NS_DETAIL::LazyLayout<Cls>;
+public:
+	explicit lazy_view(std::span<const std::byte> buffer) noexcept
+		: buffer{ buffer } {}
+
+	// Whether the buffer is large enough to hold the header.
+	bool valid() const noexcept
+	{ return buffer.size() >= Layout::header_size; }
+
+	// Decode member with specified name, std::nullopt if the buffer is malformed.
+	template<StaticString Name>
+		requires (member_index<Cls, Name>() < member_count_v<Cls>)
+	auto get(std::pmr::memory_resource* resource = nullptr) const
+	{
+		constexpr std::size_t idx = member_index<Cls, Name>();
+		using Info   = NS_DETAIL::InfoTupleElem<Cls, idx>;
+		using Member = std::remove_cv_t<typename Info::member_type>;
+		static_assert(!Info::is_function_pointer, "reflected functions are not serialized");
+
+		std::optional<Member> result;
+		if (!valid())
+			return result;
+
+		std::size_t offset = Layout::table.offset[idx];
+		if constexpr (Layout::table.slot[idx] != Layout::npos)
+		{
+			serialize_size_t value;
+			std::memcpy(&value, buffer.data() + Layout::table.slot[idx] * sizeof(serialize_size_t), sizeof(value));
+			offset = value;
+		}
+
+		const auto payload = buffer.subspan(Layout::header_size);
+		if (offset > payload.size())
+			return result;
+
+		NS_DETAIL::Decoder decoder{ payload.subspan(offset), resource };
+		decoder.decode(result.emplace());
+		if (!decoder.ok)
+			result.reset();
+		return result;
+	}
+
+	// Decode the whole object, returns false if the buffer is malformed.
+	bool decode(Cls& obj, std::pmr::memory_resource* resource = nullptr) const
+	{
+		return valid() && deserialize(buffer.subspan(Layout::header_size), obj, resource) != 0;
+	}
+
+	std::optional<Cls> decode() const
+	{
+		std::optional<Cls> result{ std::in_place };
+		if (!decode(*result))
+			result.reset();
+		return result;
+	}
+
+	std::span<const std::byte> data() const noexcept
+	{ return buffer; }
+
+private:
+	std::span<const std::byte> buffer;
+};
+
+NAMESPACE_END(NS_REFLECT)
+
+#endif //! __SIMPLE_REFLECT_LAZY_VIEW_HEADER__
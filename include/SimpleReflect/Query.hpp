@@ -0,0 +1,306 @@
+#ifndef __SIMPLE_REFLECT_QUERY_HEADER__
+#define __SIMPLE_REFLECT_QUERY_HEADER__
+
+#include <bit>
+#include <span>
+#include <ranges>
+#include <vector>
+#include <cstdint>
+#include <cstring>
+#include <concepts>
+#include <algorithm>
+#include <functional>
+
+#include "Reflect.hpp"
+#include "ColumnStore.hpp"
+
+NAMESPACE_BEGIN(NS_REFLECT)
+
+NAMESPACE_BEGIN(NS_DETAIL)
+
+// Rows are matched in blocks of 64, one bit per row.
+inline constexpr std::size_t query_block_size = 64;
+
+template<typename Op, typename T>
+struct Compare
+{
+	T value;
+
+	template<typename U>
+		requires std::invocable<Op, const U&, const T&>
+	constexpr bool operator()(const U& member) const noexcept
+	{ return Op{}(member, value); }
+};
+
+template<typename T>
+struct Between
+{
+	T low;
+	T high;
+
+	template<typename U>
+		requires std::invocable<std::greater_equal<>, const U&, const T&> && std::invocable<std::less_equal<>, const U&, const T&>
+	constexpr bool operator()(const U& member) const noexcept
+	{ return (member >= low) & (member <= high); }
+};
+
+// Strided view of one member of an array of Cls.
+// The member pointer is a template argument, so the member is read at a constant offset.
+template<reflectable Cls, std::size_t Index>
+struct StridedColumn
+{
+	using Info = InfoTupleElem<Cls, Index>;
+
+	const Cls* data;
+
+	const auto& operator[](std::size_t row) const noexcept
+	{
+		if constexpr (Info::constant != nullptr)
+			return data[row].*Info::constant;
+		else
+			return data[row].*member_info<Cls, Index>().member;
+	}
+};
+
+template<reflectable Cls>
+struct RowSource
+{
+	std::span<const Cls> data;
+
+	template<StaticString Name>
+		requires (member_index<Cls, Name>() < member_count_v<Cls>) && InfoTupleElem<Cls, member_index<Cls, Name>()>::is_object_pointer
+	auto column() const noexcept
+	{ return StridedColumn<Cls, member_index<Cls, Name>()>{ data.data() }; }
+
+	std::size_t size() const noexcept { return data.size(); }
+	const Cls& load(std::size_t row) const noexcept { return data[row]; }
+};
+
+template<reflectable Cls>
+struct ColumnSource
+{
+	const column_store<Cls>* store;
+
+	template<StaticString Name>
+		requires requires (const column_store<Cls>& store) { store.template column<Name>(); }
+	auto column() const noexcept
+	{ return store->template column<Name>(); }
+
+	std::size_t size() const noexcept { return store->size(); }
+	Cls load(std::size_t row) const { return store->load(row); }
+};
+
+// Packs one byte per row (0 or 1) into one bit per row. On little endian targets 8 rows are
+// packed at a time: the multiplication moves bit 0 of byte i into bit 56 + i, without carries.
+inline std::uint64_t pack_matches(const std::uint8_t (&matches)[query_block_size]) noexcept
+{
+	std::uint64_t bits = 0;
+	if constexpr (std::endian::native == std::endian::little)
+	{
+		for (std::size_t byte = 0; byte < query_block_size / 8; ++byte)
+		{
+			std::uint64_t word;
+			std::memcpy(&word, matches + byte * 8, sizeof(word));
+			bits |= ((word * 0x0102040810204080ull) >> 56) << (byte * 8);
+		}
+	}
+	else
+	{
+		for (std::size_t i = 0; i < query_block_size; ++i)
+			bits |= std::uint64_t{ matches[i] } << i;
+	}
+	return bits;
+}
+
+// Rows are compared into a byte mask first. That loop is branch free and has no dependency
+// between rows, so it can be vectorized for contiguous columns. Count is constant for full blocks.
+template<std::size_t Count = query_block_size, typename Column, typename Pred>
+std::uint64_t match_block(const Column& column, const Pred& pred, std::size_t begin, std::size_t count = Count) noexcept
+{
+	std::uint8_t matches[query_block_size] = {};
+	for (std::size_t i = 0; i < count; ++i)
+		matches[i] = static_cast<bool>(pred(column[begin + i]));
+	return pack_matches(matches);
+}
+
+enum class QueryCombine { And, Or };
+
+template<typename Column, typename Pred>
+struct ColumnMatch
+{
+	Column column;
+	const Pred& pred;
+
+	template<std::size_t Count>
+	std::uint64_t operator()(std::size_t block, std::size_t count) const noexcept
+	{ return match_block<Count>(column, pred, block * query_block_size, count); }
+};
+
+// And: conditions are evaluated block by block, so the rows of a block are read from memory once
+// for all of them. Later conditions are skipped for blocks without matching rows left.
+// Or: a single condition, skipped for blocks where every row matches already.
+template<QueryCombine Combine, typename ...Matches>
+	requires (Combine == QueryCombine::And || sizeof...(Matches) == 1)
+void match_columns(std::vector<std::uint64_t>& mask, std::size_t size, const Matches& ...matches)
+{
+	const std::size_t full = size / query_block_size;
+	const std::size_t tail = size % query_block_size;
+
+	const auto apply = [&]<std::size_t Count>(std::size_t block, std::size_t count) {
+		auto& bits = mask[block];
+		if constexpr (Combine == QueryCombine::And)
+			((bits = bits != 0 ? bits & matches.template operator()<Count>(block, count) : 0), ...);
+		else if (bits != ~std::uint64_t{ 0 })
+			((bits |= matches.template operator()<Count>(block, count)), ...);
+	};
+
+	for (std::size_t block = 0; block < full; ++block)
+		apply.template operator()<query_block_size>(block, query_block_size);
+	if (tail != 0)
+		apply.template operator()<0>(full, tail);
+}
+
+template<typename Range>
+using QueryRow = std::remove_cv_t<std::ranges::range_value_t<Range>>;
+
+template<typename Source, StaticString Name, typename Pred>
+concept query_predicate = std::predicate<const Pred&, decltype(std::declval<const Source&>().template column<Name>()[0])>;
+
+NAMESPACE_END(NS_DETAIL)
+
+// Predicates for where, and_ and or_
+template<typename T> constexpr auto eq(T value) { return NS_DETAIL::Compare<std::equal_to<>,      T>{ std::move(value) }; }
+template<typename T> constexpr auto ne(T value) { return NS_DETAIL::Compare<std::not_equal_to<>,  T>{ std::move(value) }; }
+template<typename T> constexpr auto lt(T value) { return NS_DETAIL::Compare<std::less<>,          T>{ std::move(value) }; }
+template<typename T> constexpr auto le(T value) { return NS_DETAIL::Compare<std::less_equal<>,    T>{ std::move(value) }; }
+template<typename T> constexpr auto gt(T value) { return NS_DETAIL::Compare<std::greater<>,       T>{ std::move(value) }; }
+template<typename T> constexpr auto ge(T value) { return NS_DETAIL::Compare<std::greater_equal<>, T>{ std::move(value) }; }
+
+// low <= member <= high
+template<typename T>
+constexpr auto between(T low, T high)
+{ return NS_DETAIL::Between<T>{ std::move(low), std::move(high) }; }
+
+// Result of a filter over an array of Cls or a column_store<Cls>, created by where.
+// Each call of and_ / or_ evaluates its conditions over all rows into a bitmask,
+// calls are combined from left to right. Conditions passed to one where or and_
+// are evaluated together, 64 rows at a time, which reads each row only once.
+// The query refers to the data, which has to outlive it.
+template<reflectable Cls, typename Source>
+class query
+{
+public:
+	using value_type = Cls;
+
+	// All rows match initially
+	explicit query(Source source)
+		: source{ source }, bits((source.size() + NS_DETAIL::query_block_size - 1) / NS_DETAIL::query_block_size, ~std::uint64_t{ 0 })
+	{
+		if (const auto tail = source.size() % NS_DETAIL::query_block_size; tail != 0)
+			bits.back() = (std::uint64_t{ 1 } << tail) - 1;
+	}
+
+	// Rows matching every pred on the member with the same position in Names
+	template<StaticString ...Names, typename ...Preds>
+		requires (sizeof...(Names) > 0 && sizeof...(Names) == sizeof...(Preds)) && (NS_DETAIL::query_predicate<Source, Names, Preds> && ...)
+	query& and_(const Preds& ...preds) &
+	{
+		match<NS_DETAIL::QueryCombine::And, Names...>(preds...);
+		return *this;
+	}
+
+	template<StaticString ...Names, typename ...Preds>
+		requires (sizeof...(Names) > 0 && sizeof...(Names) == sizeof...(Preds)) && (NS_DETAIL::query_predicate<Source, Names, Preds> && ...)
+	query&& and_(const Preds& ...preds) &&
+	{ return std::move(and_<Names...>(preds...)); }
+
+	template<StaticString Name, typename Pred>
+		requires NS_DETAIL::query_predicate<Source, Name, Pred>
+	query& or_(const Pred& pred) &
+	{
+		match<NS_DETAIL::QueryCombine::Or, Name>(pred);
+		return *this;
+	}
+
+	template<StaticString Name, typename Pred>
+		requires NS_DETAIL::query_predicate<Source, Name, Pred>
+	query&& or_(const Pred& pred) &&
+	{ return std::move(or_<Name>(pred)); }
+
+	// Number of matching rows
+	std::size_t count() const noexcept
+	{
+		std::size_t result = 0;
+		for (auto word : bits)
+			result += std::popcount(word);
+		return result;
+	}
+
+	// Bit (row % 64) of word (row / 64) is set for matching rows
+	std::span<const std::uint64_t> mask() const noexcept
+	{ return bits; }
+
+	// Indices of matching rows, ascending
+	std::vector<std::uint32_t> selection() const
+	{
+		std::vector<std::uint32_t> result;
+		result.reserve(count());
+		for_each_index([&](std::size_t row) { result.push_back(static_cast<std::uint32_t>(row)); });
+		return result;
+	}
+
+	// Copy of matching rows
+	std::vector<Cls> collect() const
+	{
+		std::vector<Cls> result;
+		result.reserve(count());
+		for_each_index([&](std::size_t row) { result.push_back(source.load(row)); });
+		return result;
+	}
+
+	template<typename Func>
+	void for_each_index(Func&& func) const
+	{
+		for (std::size_t block = 0; block < bits.size(); ++block)
+		{
+			for (auto word = bits[block]; word != 0; word &= word - 1)
+				func(block * NS_DETAIL::query_block_size + std::countr_zero(word));
+		}
+	}
+
+private:
+	template<NS_DETAIL::QueryCombine Combine, StaticString ...Names, typename ...Preds>
+	void match(const Preds& ...preds)
+	{
+		NS_DETAIL::match_columns<Combine>(bits, source.size(),
+			NS_DETAIL::ColumnMatch<decltype(source.template column<Names>()), Preds>{ source.template column<Names>(), preds }...);
+	}
+
+	Source source;
+	std::vector<std::uint64_t> bits;
+};
+
+// Start a query on an array of Cls (std::vector, std::span, std::array...), rows matching every pred
+// on the member with the same position in Names. Members are read with stride sizeof(Cls).
+template<StaticString ...Names, std::ranges::contiguous_range Range, typename ...Preds>
+	requires reflectable<NS_DETAIL::QueryRow<Range>> && (sizeof...(Names) > 0 && sizeof...(Names) == sizeof...(Preds))
+		&& (NS_DETAIL::query_predicate<NS_DETAIL::RowSource<NS_DETAIL::QueryRow<Range>>, Names, Preds> && ...)
+auto where(const Range& data, const Preds& ...preds)
+{
+	using Cls = NS_DETAIL::QueryRow<Range>;
+	NS_DETAIL::RowSource<Cls> source{ std::span<const Cls>{ std::ranges::data(data), std::ranges::size(data) } };
+	return query<Cls, decltype(source)>{ source }.template and_<Names...>(preds...);
+}
+
+// Start a query on a column_store, members are read from contiguous columns.
+template<StaticString ...Names, reflectable Cls, typename ...Preds>
+	requires (sizeof...(Names) > 0 && sizeof...(Names) == sizeof...(Preds))
+		&& (NS_DETAIL::query_predicate<NS_DETAIL::ColumnSource<Cls>, Names, Preds> && ...)
+auto where(const column_store<Cls>& data, const Preds& ...preds)
+{
+	return query<Cls, NS_DETAIL::ColumnSource<Cls>>{ { &data } }.template and_<Names...>(preds...);
+}
+
+NAMESPACE_END(NS_REFLECT)
+
+#endif //! __SIMPLE_REFLECT_QUERY_HEADER__
@@ -1,7 +1,8 @@
 #ifndef __SIMPLE_REFLECT_HEADER__
 #define __SIMPLE_REFLECT_HEADER__
 
-#include <tuple>
+#include <array>
+#include <utility>
 #include <functional>
 
 #include "Defines.hpp"
@@ -15,13 +16,23 @@ NAMESPACE_BEGIN(NS_DETAIL)
 
 //////////////////////////////////////////////////////////////
 
+// Distinct type for each member name, used to find members by name with overload resolution.
+// Never defined, so pointers to different tags are not convertible to each other.
+template<StaticString Name>
+struct MemberNameTag;
+
 // This class holds the actual class member pointer and it's name.
-template<StaticString Name, typename MemberPointer>
+// Cold marks a rarely accessed member, see REFLECT_MEMBER_COLD.
+// Constant is the same member pointer as a template argument when it's known at compile time,
+// so member offsets are constants in generated code.
+template<StaticString Name, typename MemberPointer, bool Cold = false, MemberPointer Constant = nullptr>
 	requires std::is_member_pointer_v<MemberPointer>
 struct MemberTypeInfo
 {
 	constexpr static bool is_function_pointer = std::is_member_function_pointer_v<MemberPointer>;
 	constexpr static bool is_object_pointer   = std::is_member_object_pointer_v  <MemberPointer>;
+	constexpr static bool is_cold = Cold;
+	constexpr static MemberPointer constant = Constant;
 
 	using class_type  = NS_DETAIL::MemberPointerClass<MemberPointer>;
 	using member_type = NS_DETAIL::MemberPointerType <MemberPointer>;
@@ -32,18 +43,74 @@ struct MemberTypeInfo
 	using string_view_type = std::basic_string_view<char_type>;
 
 	constexpr static string_view_type name = Name;
+	using name_tag = MemberNameTag<Name>;
+
 	MemberPointer member;
 
 	template<typename Cls>
-	auto& to_real_variable(Cls* ptr)
+	constexpr auto& to_real_variable(Cls* ptr)
 	{
 		if constexpr (std::is_member_function_pointer_v<MemberPointer>)
 			return member;
+		else if constexpr (Constant != nullptr)
+			return ptr->*Constant;
 		else
 			return ptr->*member;
 	}
 };
 
+// One element of MemberList, Index keeps elements of the same type distinct.
+template<std::size_t Index, typename Info>
+struct MemberListLeaf
+{
+	Info info;
+
+	static constexpr std::size_t index_of(typename Info::name_tag*) noexcept
+	{ return Index; }
+};
+
+template<typename Seq, typename ...Infos>
+struct MemberListBase;
+
+template<std::size_t ...Indices, typename ...Infos>
+struct MemberListBase<std::index_sequence<Indices...>, Infos...>
+	: MemberListLeaf<Indices, Infos>...
+{
+	constexpr MemberListBase(Infos... infos)
+		: MemberListLeaf<Indices, Infos>{ infos }... {}
+
+	// Index of the member with a name, looked up with one overload resolution
+	// instead of comparing all names. (std::size_t)-1 if there is no such member.
+	using MemberListLeaf<Indices, Infos>::index_of...;
+	static constexpr std::size_t index_of(const void*) noexcept
+	{ return (std::size_t)-1; }
+
+	// Invoke func with all member infos, in order of declaration.
+	template<typename Func>
+	constexpr decltype(auto) apply(Func&& func)
+	{ return std::invoke(std::forward<Func>(func), static_cast<MemberListLeaf<Indices, Infos>&>(*this).info...); }
+};
+
+// Type of MEMBER_TYPE_INFO_TUPLE.
+// Unlike std::tuple, elements are direct bases of one class instead of a recursive chain,
+// so classes with hundreds of members don't hit template depth limits.
+template<typename ...Infos>
+struct MemberList : MemberListBase<std::index_sequence_for<Infos...>, Infos...>
+{
+	using MemberListBase<std::index_sequence_for<Infos...>, Infos...>::MemberListBase;
+
+	inline static constexpr const std::size_t size = sizeof...(Infos);
+};
+
+template<typename ...Infos>
+MemberList(Infos...) -> MemberList<Infos...>;
+
+// Element Index of a MemberList. Info is deduced from the base class, which doesn't
+// instantiate anything per element.
+template<std::size_t Index, typename Info>
+constexpr Info& get(MemberListLeaf<Index, Info>& leaf) noexcept
+{ return leaf.info; }
+
 // This class is the MEMBER_TYPE_INFO_TUPLE wrapper in global.
 // It holds the MEMBER_TYPE_INFO_TUPLE for Cls.
 template<typename Cls>
@@ -67,7 +134,7 @@ struct MemberInfoWrapper {
 template<typename Cls>
 	requires requires {
 		Cls::MEMBER_TYPE_INFO_TUPLE;
-		is_specialization<decltype(Cls::MEMBER_TYPE_INFO_TUPLE), std::tuple>::value;
+		is_specialization<decltype(Cls::MEMBER_TYPE_INFO_TUPLE), MemberList>::value;
 	}
 struct MemberInfoWrapper<Cls> {
 	using type = Cls;
@@ -76,7 +143,7 @@ template<typename Cls>
 	requires requires {
 		GlobalMemberInfoTupleWrapper<Cls>::MEMBER_TYPE_INFO_TUPLE;
 		is_specialization<
-			decltype(GlobalMemberInfoTupleWrapper<Cls>::MEMBER_TYPE_INFO_TUPLE), std::tuple
+			decltype(GlobalMemberInfoTupleWrapper<Cls>::MEMBER_TYPE_INFO_TUPLE), MemberList
 		>::value;
 	}
 struct MemberInfoWrapper<Cls> {
@@ -86,6 +153,14 @@ struct MemberInfoWrapper<Cls> {
 template<typename Cls>
 using MemberInfoWrapperType = typename MemberInfoWrapper<std::remove_cvref_t<Cls>>::type;
 
+template<typename Cls>
+using MemberListType = std::remove_cvref_t<decltype(MemberInfoWrapperType<Cls>::MEMBER_TYPE_INFO_TUPLE)>;
+
+// Info of the member Index of Cls
+template<typename Cls, std::size_t Index>
+constexpr auto& member_info() noexcept
+{ return NS_DETAIL::get<Index>(MemberInfoWrapperType<Cls>::MEMBER_TYPE_INFO_TUPLE); }
+
 //////////////////////////////////////////////////////////////
 
 // This class is used to create overloaded function pointer
@@ -147,7 +222,7 @@ struct is_reflectable : std::false_type {};
 template<typename T>
 	requires requires (T t) {
 		NS_DETAIL::MemberInfoWrapperType<T>::MEMBER_TYPE_INFO_TUPLE;
-		is_specialization<decltype(NS_DETAIL::MemberInfoWrapperType<T>::MEMBER_TYPE_INFO_TUPLE), std::tuple>::value;
+		is_specialization<decltype(NS_DETAIL::MemberInfoWrapperType<T>::MEMBER_TYPE_INFO_TUPLE), NS_DETAIL::MemberList>::value;
 	}
 struct is_reflectable<T> : std::true_type {};
 
@@ -159,10 +234,24 @@ concept reflectable = is_reflectable_v<T>;
 
 //////////////////////////////////////////////////////////////
 
+#if REFLECT_INSTRUMENT_ACCESS
 NAMESPACE_BEGIN(NS_DETAIL)
-
+// defined in Instrument.hpp
+template<typename Cls>
+void record_access(std::size_t index) noexcept;
+template<typename Cls>
+void record_access_all() noexcept;
 NAMESPACE_END(NS_DETAIL)
 
+#define REFLECT_RECORD_ACCESS(cls, index) \
+	do { if (!std::is_constant_evaluated()) NS_REFLECT::NS_DETAIL::record_access<std::remove_cvref_t<cls>>(index); } while (0)
+#define REFLECT_RECORD_ACCESS_ALL(cls) \
+	do { if (!std::is_constant_evaluated()) NS_REFLECT::NS_DETAIL::record_access_all<std::remove_cvref_t<cls>>(); } while (0)
+#else
+#define REFLECT_RECORD_ACCESS(cls, index) ((void)0)
+#define REFLECT_RECORD_ACCESS_ALL(cls) ((void)0)
+#endif
+
 // Type trait class that determine if Func can be invoked as
 // Func(Cls*, StringT, MemberT&).
 // Cls and MemberT can be const.
@@ -188,9 +277,7 @@ concept for_each_member_invokable =
 template<reflectable Cls>
 struct member_count
 {
-	inline static constexpr std::size_t value =std::tuple_size_v<
-		decltype(NS_DETAIL::MemberInfoWrapperType<Cls>::MEMBER_TYPE_INFO_TUPLE)
-	>;
+	inline static constexpr std::size_t value = NS_DETAIL::MemberListType<Cls>::size;
 };
 
 template<reflectable Cls>
@@ -220,7 +307,7 @@ constexpr void for_each_member_impl(Cls* ptr, Func&& func, std::index_sequence<I
 {
 	for_each_member_impl_expand(
 		ptr, std::forward<Func>(func),
-		std::get<Indices>(MemberInfoWrapperType<Cls>::MEMBER_TYPE_INFO_TUPLE)...
+		member_info<Cls, Indices>()...
 	);
 }
 
@@ -228,24 +315,19 @@ template<typename Cls, typename Func, std::size_t ...Indices>
 constexpr void visit_member_impl(Func&& func, std::index_sequence<Indices...>)
 {
 	(std::invoke(
-		std::forward<Func>(func), std::get<Indices>(MemberInfoWrapperType<Cls>::MEMBER_TYPE_INFO_TUPLE)
+		std::forward<Func>(func), member_info<Cls, Indices>(),
+		std::integral_constant<std::size_t, Indices>{}
 	), ...);
 }
 
 
 template<reflectable Cls, std::size_t Index>
-using InfoTupleElem = std::remove_cvref_t<
-	decltype(std::get<Index>(NS_DETAIL::MemberInfoWrapperType<Cls>::MEMBER_TYPE_INFO_TUPLE))
->;
+using InfoTupleElem = std::remove_cvref_t<decltype(member_info<Cls, Index>())>;
 
-template<reflectable Cls, StaticString Name, std::size_t ...Indices>
-constexpr std::size_t member_index_impl(std::index_sequence<Indices...>)
+template<reflectable Cls, StaticString Name>
+constexpr std::size_t member_index_impl()
 {
-	std::size_t result = (std::size_t)-1;
-	((InfoTupleElem<Cls, Indices>::name == Name
-		? (result = Indices) : 0
-	), ...);
-	return result;
+	return MemberListType<Cls>::index_of(static_cast<MemberNameTag<Name>*>(nullptr));
 }
 
 NAMESPACE_END(NS_DETAIL)
@@ -254,15 +336,18 @@ NAMESPACE_END(NS_DETAIL)
 template<reflectable Cls, typename Func>
 constexpr void for_each_member(Cls* ptr, Func&& func)
 {
-	using TupleIndex = std::make_index_sequence<member_count_v<Cls>>;
-	NS_DETAIL::for_each_member_impl(ptr, std::forward<Func>(func), TupleIndex{});
+	REFLECT_RECORD_ACCESS_ALL(Cls);
+	NS_DETAIL::MemberInfoWrapperType<Cls>::MEMBER_TYPE_INFO_TUPLE.apply(
+		[&](auto& ...info) constexpr {
+			NS_DETAIL::for_each_member_impl_expand(ptr, std::forward<Func>(func), info...);
+		}
+	);
 }
 
 template<reflectable Cls, StaticString Name>
 constexpr std::make_signed_t<std::size_t> member_index()
 {
-	using TupleIndex = std::make_index_sequence<member_count_v<Cls>>;
-	return NS_DETAIL::member_index_impl<Cls, Name>(TupleIndex{});
+	return NS_DETAIL::member_index_impl<Cls, Name>();
 }
 
 template<StaticString Name, reflectable Cls>
@@ -270,7 +355,8 @@ template<StaticString Name, reflectable Cls>
 constexpr auto& get_member(Cls* ptr)
 {
 	constexpr auto idx = member_index<Cls, Name>();
-	return std::get<idx>(NS_DETAIL::MemberInfoWrapperType<Cls>::MEMBER_TYPE_INFO_TUPLE).to_real_variable(ptr);
+	REFLECT_RECORD_ACCESS(Cls, idx);
+	return NS_DETAIL::member_info<Cls, idx>().to_real_variable(ptr);
 }
 
 template<StaticString Name, reflectable Cls>
@@ -286,12 +372,13 @@ constexpr void visit_member(Cls* ptr, const StringT& name, Func&& visitor)
 {
 	using TupleIndex = std::make_index_sequence<member_count_v<Cls>>;
 	NS_DETAIL::visit_member_impl<Cls>(
-		[&name, visitor, ptr](auto& pair) constexpr {
+		[&name, visitor, ptr](auto& pair, [[maybe_unused]] auto index) constexpr {
 			using MemberType = std::decay_t<decltype(pair.to_real_variable(ptr))>;
 			if constexpr (std::is_invocable_v<Func, Cls*, MemberType&>)
 			{
 				if (pair.name != name)
 					return;
+				REFLECT_RECORD_ACCESS(Cls, index());
 				visitor(ptr, pair.to_real_variable(ptr));
 			}
 		},
@@ -307,15 +394,166 @@ constexpr void visit_member(Cls* ptr, Func&& visitor)
 	visitor(ptr, get_member<Name>(ptr));
 }
 
+//////////////////////////////////////////////////////////////
+
+// A compile time subset of reflected members of Cls, in the given order.
+template<reflectable Cls, std::size_t ...Indices>
+	requires ((Indices < member_count_v<Cls>) && ...)
+struct member_subset
+{
+	using class_type = Cls;
+	using index_sequence = std::index_sequence<Indices...>;
+	inline static constexpr const std::size_t size = sizeof...(Indices);
+};
+
+template<typename T>
+inline constexpr bool is_member_subset_v = false;
+
+template<typename Cls, std::size_t ...Indices>
+inline constexpr bool is_member_subset_v<member_subset<Cls, Indices...>> = true;
+
+// Subset of members with specified names.
+template<reflectable Cls, StaticString ...Names>
+using select_names = member_subset<Cls, member_index<Cls, Names>()...>;
+
+NAMESPACE_BEGIN(NS_DETAIL)
+
+template<reflectable Cls, auto Pred, std::size_t ...Indices>
+constexpr auto filter_members(std::index_sequence<Indices...>) noexcept
+{
+	constexpr bool selected[] = { Pred(std::type_identity<InfoTupleElem<Cls, Indices>>{})..., false };
+	std::array<std::size_t, (selected[Indices] + ... + 0)> result{};
+	for (std::size_t i = 0, n = 0; i < sizeof...(Indices); ++i) {
+		if (selected[i])
+			result[n++] = i;
+	}
+	return result;
+}
+
+template<reflectable Cls, auto Pred>
+struct SelectMembers
+{
+	inline static constexpr const auto indices = filter_members<Cls, Pred>(
+		std::make_index_sequence<member_count_v<Cls>>{}
+	);
+
+	template<std::size_t ...J>
+	static auto make(std::index_sequence<J...>) -> member_subset<Cls, indices[J]...>;
+
+	using type = decltype(make(std::make_index_sequence<indices.size()>{}));
+};
+
+NAMESPACE_END(NS_DETAIL)
+
+// Subset of members for which Pred(std::type_identity<MemberInfo>{}) is true.
+// Pred is evaluated on member info types only, visitors are never instantiated for other members.
+template<reflectable Cls, auto Pred>
+using select_members = typename NS_DETAIL::SelectMembers<Cls, Pred>::type;
+
+// Predicates for select_members
+inline constexpr auto data_members = []<typename Info>(std::type_identity<Info>) constexpr {
+	return Info::is_object_pointer;
+};
+inline constexpr auto function_members = []<typename Info>(std::type_identity<Info>) constexpr {
+	return Info::is_function_pointer;
+};
+inline constexpr auto trivially_copyable_members = []<typename Info>(std::type_identity<Info>) constexpr {
+	return Info::is_object_pointer && std::is_trivially_copyable_v<typename Info::member_type>;
+};
+template<StaticString Prefix>
+inline constexpr auto name_starts_with = []<typename Info>(std::type_identity<Info>) constexpr {
+	return Info::name.starts_with(std::basic_string_view<typename decltype(Prefix)::value_type>{ Prefix });
+};
+
+// A reference to an object, restricted to a subset of its members.
+// Accepted by for_each_member, serialize and equal in place of the object.
+template<typename Subset, typename Cls>
+	requires is_member_subset_v<Subset> && std::is_same_v<typename Subset::class_type, std::remove_cv_t<Cls>>
+struct projection
+{
+	using subset_type = Subset;
+	using class_type  = Cls;
+
+	Cls* ptr;
+};
+
+template<typename T>
+inline constexpr bool is_projection_v = is_specialization_v<std::remove_cvref_t<T>, projection>;
+
+template<StaticString ...Names, reflectable Cls>
+constexpr auto project(Cls* ptr) noexcept
+{ return projection<select_names<std::remove_cv_t<Cls>, Names...>, Cls>{ ptr }; }
+
+template<StaticString ...Names, reflectable Cls>
+constexpr auto project(Cls& obj) noexcept
+{ return project<Names...>(&obj); }
+
+template<reflectable Cls, typename Subset>
+	requires is_member_subset_v<Subset>
+constexpr auto project(Cls& obj, Subset) noexcept
+{ return projection<Subset, Cls>{ &obj }; }
+
+// Iterate through members in the subset only, in order of the subset.
+template<typename Subset, typename Cls, typename Func>
+constexpr void for_each_member(projection<Subset, Cls> proj, Func&& func)
+{
+	[&]<std::size_t ...Indices>(std::index_sequence<Indices...> seq) {
+		[[maybe_unused]] constexpr std::size_t indices[] = { Indices..., 0 };
+		for (std::size_t i = 0; i < sizeof...(Indices); ++i)
+			REFLECT_RECORD_ACCESS(Cls, indices[i]);
+		NS_DETAIL::for_each_member_impl(proj.ptr, std::forward<Func>(func), seq);
+	}(typename Subset::index_sequence{});
+}
+
+NAMESPACE_BEGIN(NS_DETAIL)
+
+template<typename T>
+constexpr bool equal_value(const T& lhs, const T& rhs);
+
+template<typename Cls, std::size_t ...Indices>
+constexpr bool equal_members(const Cls& lhs, const Cls& rhs, std::index_sequence<Indices...>)
+{
+	return ([&] {
+		using Info = InfoTupleElem<Cls, Indices>;
+		if constexpr (Info::is_function_pointer)
+			return true;
+		else
+		{
+			auto& info = member_info<Cls, Indices>();
+			return equal_value(info.to_real_variable(&lhs), info.to_real_variable(&rhs));
+		}
+	}() && ...);
+}
+
+template<typename T>
+constexpr bool equal_value(const T& lhs, const T& rhs)
+{
+	if constexpr (std::is_array_v<T>)
+		return std::ranges::equal(lhs, rhs, [](const auto& l, const auto& r) { return equal_value(l, r); });
+	else if constexpr (requires { { lhs == rhs } -> std::convertible_to<bool>; })
+		return lhs == rhs;
+	else
+		return equal_members(lhs, rhs, std::make_index_sequence<member_count_v<T>>{});
+}
+
+NAMESPACE_END(NS_DETAIL)
+
+// Compare reflected data members one by one, using operator== if a member has one,
+// otherwise comparing its reflected members recursively. Functions are ignored.
+template<reflectable Cls>
+constexpr bool equal(const Cls& lhs, const Cls& rhs)
+{ return NS_DETAIL::equal_members(lhs, rhs, std::make_index_sequence<member_count_v<Cls>>{}); }
+
+// Compare only the members in the subset.
+template<typename Subset, typename ClsL, typename ClsR>
+constexpr bool equal(projection<Subset, ClsL> lhs, projection<Subset, ClsR> rhs)
+{ return NS_DETAIL::equal_members(*lhs.ptr, *rhs.ptr, typename Subset::index_sequence{}); }
+
 NAMESPACE_BEGIN(NS_DETAIL)
-template<typename Cls, typename Container, std::size_t ...Indices>
-constexpr Container member_names_impl(std::index_sequence<Indices...>)
+template<typename Container, typename ...Infos>
+constexpr Container member_names_impl(std::type_identity<MemberList<Infos...>>)
 {
-	constexpr auto extract_name = [](const auto& info) constexpr {
-		using MemberInfoT = std::remove_cvref_t<decltype(info)>;
-		return typename Container::value_type{ MemberInfoT::name };
-	};
-	return { extract_name(std::get<Indices>(MemberInfoWrapperType<Cls>::MEMBER_TYPE_INFO_TUPLE))... };
+	return { typename Container::value_type{ Infos::name }... };
 }
 NAMESPACE_END(NS_DETAIL)
 
@@ -324,10 +562,7 @@ NAMESPACE_END(NS_DETAIL)
 template<typename Cls, typename Container>
 constexpr Container member_names()
 {
-	using TupleIndex = std::make_index_sequence<
-		std::tuple_size_v<decltype(NS_DETAIL::MemberInfoWrapperType<Cls>::MEMBER_TYPE_INFO_TUPLE)>
-	>;
-	return NS_DETAIL::member_names_impl<Cls, Container>(TupleIndex{});
+	return NS_DETAIL::member_names_impl<Container>(std::type_identity<NS_DETAIL::MemberListType<Cls>>{});
 }
 
 // Get all reflected member names from Cls, store them in Container.
@@ -369,7 +604,7 @@ NAMESPACE_END(NS_REFLECT)
 	template<typename FuncT, NS_REFLECT::StaticString Name>       \
 	static inline const constexpr auto& \
 		REFLECT_METHOD = NS_REFLECT::NS_DETAIL::ReflectMethodImpl<FuncT, Name>;  \
-	static inline auto MEMBER_TYPE_INFO_TUPLE = std::tuple
+	static inline auto MEMBER_TYPE_INFO_TUPLE = NS_REFLECT::NS_DETAIL::MemberList
 #define REFLECT_DEFINE_IMPL_1(cls) \
 	using ThisClass = cls; REFLECT_DEFINE_IMPL_0()
 #define REFLECT_DEFINE_IMPL_GET(_0, _1, NAME, ...) NAME
@@ -380,8 +615,8 @@ NAMESPACE_END(NS_REFLECT)
 
 
 #define REFLECT_MEMBER_IMPL_2(name, member) \
-	NS_REFLECT::NS_DETAIL::MemberTypeInfo<name, decltype(&ThisClass::member)>{ &ThisClass::member }
-#ifdef USE_WCHAR
+	NS_REFLECT::NS_DETAIL::MemberTypeInfo<name, decltype(&ThisClass::member), false, &ThisClass::member>{ &ThisClass::member }
+#if USE_WCHAR
 #define REFLECT_MEMBER_IMPL_1(member) REFLECT_MEMBER_IMPL_2(TXT(#member), member)
 #else
 #define REFLECT_MEMBER_IMPL_1(member) REFLECT_MEMBER_IMPL_2(#member, member)
@@ -392,10 +627,27 @@ NAMESPACE_END(NS_REFLECT)
 #define REFLECT_MEMBER(...) \
 	REFLECT_MEMBER_IMPL_GET(__VA_ARGS__, REFLECT_MEMBER_IMPL_2, REFLECT_MEMBER_IMPL_1)(__VA_ARGS__)
 
+#define REFLECT_MEMBER_COLD_IMPL_2(name, member) \
+	NS_REFLECT::NS_DETAIL::MemberTypeInfo<name, decltype(&ThisClass::member), true, &ThisClass::member>{ &ThisClass::member }
+#if USE_WCHAR
+#define REFLECT_MEMBER_COLD_IMPL_1(member) REFLECT_MEMBER_COLD_IMPL_2(TXT(#member), member)
+#else
+#define REFLECT_MEMBER_COLD_IMPL_1(member) REFLECT_MEMBER_COLD_IMPL_2(#member, member)
+#endif
+
+// Same as REFLECT_MEMBER, but marks the member as rarely accessed.
+// usage: REFLECT_MEMBER_COLD(name, member) or REFLECT_MEMBER_COLD(member)
+#define REFLECT_MEMBER_COLD(...) \
+	REFLECT_MEMBER_IMPL_GET(__VA_ARGS__, REFLECT_MEMBER_COLD_IMPL_2, REFLECT_MEMBER_COLD_IMPL_1)(__VA_ARGS__)
+
 // use __VA_ARGS__ to handle templates, like: std::map<int, int>
 #define REFLECT_DEFINE_GLOBAL(...)    \
 	template<> struct NS_REFLECT::NS_DETAIL::GlobalMemberInfoTupleWrapper<__VA_ARGS__> \
 		: NS_REFLECT::NS_DETAIL::GlobalMemberInfoTupleWrapperBase<__VA_ARGS__>
 
+#if REFLECT_INSTRUMENT_ACCESS
+#include "Instrument.hpp"
+#endif
+
 
 #endif //! __SIMPLE_REFLECT_HEADER__
\ No newline at end of file
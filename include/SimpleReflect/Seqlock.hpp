@@ -0,0 +1,182 @@
+#ifndef __SIMPLE_REFLECT_SEQLOCK_HEADER__
+#define __SIMPLE_REFLECT_SEQLOCK_HEADER__
+
+#include <array>
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <cstdint>
+#include <cstring>
+
+#include "Reflect.hpp"
+
+NAMESPACE_BEGIN(NS_REFLECT)
+
+NAMESPACE_BEGIN(NS_DETAIL)
+
+// Largest unsigned integer, up to 8 bytes, that T is aligned to.
+template<typename T>
+using SeqlockWord =
+	std::conditional_t<alignof(T) >= 8, std::uint64_t,
+	std::conditional_t<alignof(T) >= 4, std::uint32_t,
+	std::conditional_t<alignof(T) >= 2, std::uint16_t, std::uint8_t>>>;
+
+// Members are copied word by word with relaxed atomic accesses,
+// so reads concurrent with a write are not data races, only possibly torn.
+template<typename T>
+void relaxed_load(const T& shared, T& out) noexcept
+{
+	using Word = SeqlockWord<T>;
+	auto* words = reinterpret_cast<Word*>(const_cast<std::remove_cv_t<T>*>(std::addressof(shared)));
+
+	std::array<Word, sizeof(T) / sizeof(Word)> buffer;
+	for (std::size_t i = 0; i < buffer.size(); ++i)
+		buffer[i] = std::atomic_ref<Word>{ words[i] }.load(std::memory_order_relaxed);
+	std::memcpy(std::addressof(out), buffer.data(), sizeof(T));
+}
+
+template<typename T>
+void relaxed_store(T& shared, const T& value) noexcept
+{
+	using Word = SeqlockWord<T>;
+	auto* words = reinterpret_cast<Word*>(std::addressof(shared));
+
+	std::array<Word, sizeof(T) / sizeof(Word)> buffer;
+	std::memcpy(buffer.data(), std::addressof(value), sizeof(T));
+	for (std::size_t i = 0; i < buffer.size(); ++i)
+		std::atomic_ref<Word>{ words[i] }.store(buffer[i], std::memory_order_relaxed);
+}
+
+template<reflectable Cls, std::size_t Index>
+auto& seqlock_member(auto& obj) noexcept
+{ return member_info<Cls, Index>().to_real_variable(std::addressof(obj)); }
+
+template<reflectable Cls, std::size_t ...Indices>
+void relaxed_load_members(const Cls& shared, Cls& out, std::index_sequence<Indices...>) noexcept
+{
+	([&] {
+		if constexpr (InfoTupleElem<Cls, Indices>::is_object_pointer)
+			relaxed_load(seqlock_member<Cls, Indices>(shared), seqlock_member<Cls, Indices>(out));
+	}(), ...);
+}
+
+template<reflectable Cls, std::size_t ...Indices>
+void relaxed_store_members(Cls& shared, const Cls& value, std::index_sequence<Indices...>) noexcept
+{
+	([&] {
+		if constexpr (InfoTupleElem<Cls, Indices>::is_object_pointer)
+			relaxed_store(seqlock_member<Cls, Indices>(shared), seqlock_member<Cls, Indices>(value));
+	}(), ...);
+}
+
+NAMESPACE_END(NS_DETAIL)
+
+// Every reflected data member is trivially copyable.
+template<typename Cls>
+concept seqlock_compatible = reflectable<Cls> && std::is_default_constructible_v<Cls> &&
+	select_members<Cls, data_members>::size == select_members<Cls, trivially_copyable_members>::size;
+
+// A value of Cls published by a single writer and read by any number of threads without locks.
+// The writer makes the sequence number odd, stores members, then makes it even again.
+// Readers copy members and retry if the sequence number was odd or has changed meanwhile.
+// Only reflected members are copied, other members of Cls keep their default values in snapshots.
+template<seqlock_compatible Cls>
+class seqlock_cell
+{
+	using Members = std::make_index_sequence<member_count_v<Cls>>;
+public:
+	using value_type = Cls;
+
+	seqlock_cell() = default;
+
+	explicit seqlock_cell(const Cls& value)
+		: value{ value } {}
+
+	seqlock_cell(const seqlock_cell&) = delete;
+	seqlock_cell& operator=(const seqlock_cell&) = delete;
+
+	// Writer side, stores may not be called concurrently.
+	void store(const Cls& obj) noexcept
+	{ write([&] { NS_DETAIL::relaxed_store_members(value, obj, Members{}); }); }
+
+	// Store only members of the projection.
+	template<typename Subset, typename C>
+		requires std::is_same_v<std::remove_cv_t<C>, Cls>
+	void store(projection<Subset, C> proj) noexcept
+	{ write([&] { NS_DETAIL::relaxed_store_members(value, *proj.ptr, typename Subset::index_sequence{}); }); }
+
+	// Writer side, func modifies a copy of the current value which is then stored.
+	template<typename Func>
+		requires std::invocable<Func&, Cls&>
+	void update(Func&& func)
+	{
+		Cls copy{};
+		// the writer is the only thread modifying value, no need to check sequence number
+		NS_DETAIL::relaxed_load_members(value, copy, Members{});
+		func(copy);
+		store(copy);
+	}
+
+	// Consistent snapshot of all members
+	Cls load() const noexcept
+	{
+		Cls obj{};
+		load(obj);
+		return obj;
+	}
+
+	void load(Cls& out) const noexcept
+	{ read([&] { NS_DETAIL::relaxed_load_members(value, out, Members{}); }); }
+
+	// Consistent snapshot of members of the projection, written into the projected object.
+	template<typename Subset>
+	void load(projection<Subset, Cls> out) const noexcept
+	{ read([&] { NS_DETAIL::relaxed_load_members(value, *out.ptr, typename Subset::index_sequence{}); }); }
+
+	// Single attempt, returns false if a write was in progress, out may be modified anyway.
+	bool try_load(Cls& out) const noexcept
+	{ return read_once([&] { NS_DETAIL::relaxed_load_members(value, out, Members{}); }); }
+
+	// Incremented twice by every store
+	std::uint64_t version() const noexcept
+	{ return sequence.load(std::memory_order_acquire); }
+
+private:
+	template<typename Func>
+	void write(Func&& func) noexcept
+	{
+		const auto seq = sequence.load(std::memory_order_relaxed);
+		sequence.store(seq + 1, std::memory_order_relaxed);
+		std::atomic_thread_fence(std::memory_order_release);
+		func();
+		sequence.store(seq + 2, std::memory_order_release);
+	}
+
+	template<typename Func>
+	bool read_once(Func&& func) const noexcept
+	{
+		const auto before = sequence.load(std::memory_order_acquire);
+		if (before & 1)
+			return false;
+		func();
+		std::atomic_thread_fence(std::memory_order_acquire);
+		return sequence.load(std::memory_order_relaxed) == before;
+	}
+
+	template<typename Func>
+	void read(Func&& func) const noexcept
+	{
+		// back off if the writer seems to be preempted in the middle of a store
+		for (std::size_t attempt = 1; !read_once(func); ++attempt) {
+			if (attempt % 64 == 0)
+				std::this_thread::yield();
+		}
+	}
+
+	alignas(64) std::atomic<std::uint64_t> sequence{ 0 };
+	Cls value{};
+};
+
+NAMESPACE_END(NS_REFLECT)
+
+#endif //! __SIMPLE_REFLECT_SEQLOCK_HEADER__
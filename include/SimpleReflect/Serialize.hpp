@@ -0,0 +1,340 @@
+#ifndef __SIMPLE_REFLECT_SERIALIZE_HEADER__
+#define __SIMPLE_REFLECT_SERIALIZE_HEADER__
+
+#include <span>
+#include <vector>
+#include <memory>
+#include <cstddef>
+#include <cstring>
+#include <limits>
+#include <algorithm>
+#include <stdexcept>
+#include <memory_resource>
+
+#include "Reflect.hpp"
+
+NAMESPACE_BEGIN(NS_REFLECT)
+
+// Binary format:
+//   arithmetic, enum and other trivially copyable types: raw bytes
+//   std::basic_string, std::vector: length (std::uint32_t), followed by elements
+//   (std::vector<bool> packs its elements into bits and is not supported)
+//   reflectable types: reflected data members in order of declaration, functions are skipped
+// Byte order is the native one, it is not meant to be exchanged between different platforms.
+using serialize_size_t = std::uint32_t;
+
+template<typename T>
+concept serializable_sequence =
+	is_specialization_v<std::remove_cvref_t<T>, std::basic_string> ||
+	(is_specialization_v<std::remove_cvref_t<T>, std::vector> && !std::is_same_v<typename std::remove_cvref_t<T>::value_type, bool>);
+
+// Container that allocates from a std::pmr::memory_resource.
+template<typename T>
+concept pmr_container = serializable_sequence<T> && std::is_same_v<
+	typename std::remove_cvref_t<T>::allocator_type,
+	std::pmr::polymorphic_allocator<typename std::remove_cvref_t<T>::value_type>
+>;
+
+inline constexpr std::size_t variable_encoded_size = (std::size_t)-1;
+
+NAMESPACE_BEGIN(NS_DETAIL)
+
+template<typename T>
+constexpr std::size_t encoded_size() noexcept;
+
+template<typename MemberInfo>
+constexpr std::size_t member_encoded_size() noexcept
+{
+	if constexpr (MemberInfo::is_function_pointer)
+		return 0;
+	else
+		return encoded_size<std::remove_cv_t<typename MemberInfo::member_type>>();
+}
+
+template<typename Cls, std::size_t ...Indices>
+constexpr std::size_t reflectable_encoded_size(std::index_sequence<Indices...>) noexcept
+{
+	constexpr std::size_t sizes[] = { member_encoded_size<InfoTupleElem<Cls, Indices>>()..., 0 };
+	std::size_t total = 0;
+	for (auto size : sizes) {
+		if (size == variable_encoded_size)
+			return variable_encoded_size;
+		total += size;
+	}
+	return total;
+}
+
+template<typename T>
+constexpr std::size_t encoded_size() noexcept
+{
+	if constexpr (reflectable<T>)
+		return reflectable_encoded_size<T>(std::make_index_sequence<member_count_v<T>>{});
+	else if constexpr (serializable_sequence<T>)
+		return variable_encoded_size;
+	else
+		return sizeof(T);
+}
+
+template<typename T>
+constexpr std::size_t min_encoded_size() noexcept;
+
+template<typename MemberInfo>
+constexpr std::size_t member_min_encoded_size() noexcept
+{
+	if constexpr (MemberInfo::is_function_pointer)
+		return 0;
+	else
+		return min_encoded_size<std::remove_cv_t<typename MemberInfo::member_type>>();
+}
+
+template<typename Cls, std::size_t ...Indices>
+constexpr std::size_t reflectable_min_encoded_size(std::index_sequence<Indices...>) noexcept
+{ return (std::size_t{ 0 } + ... + member_min_encoded_size<InfoTupleElem<Cls, Indices>>()); }
+
+// Lower bound of encoded size, used to reject length prefixes the input can not hold.
+template<typename T>
+constexpr std::size_t min_encoded_size() noexcept
+{
+	if constexpr (reflectable<T>)
+		return reflectable_min_encoded_size<T>(std::make_index_sequence<member_count_v<T>>{});
+	else if constexpr (serializable_sequence<T>)
+		return sizeof(serialize_size_t);
+	else
+		return sizeof(T);
+}
+
+NAMESPACE_END(NS_DETAIL)
+
+// Number of bytes T is serialized into, or variable_encoded_size if it depends on the value.
+template<typename T>
+inline constexpr std::size_t encoded_size_v = NS_DETAIL::encoded_size<T>();
+
+NAMESPACE_BEGIN(NS_DETAIL)
+
+template<std::size_t Size>
+struct ArenaBuffer
+{
+	alignas(std::max_align_t) std::byte buffer[Size];
+};
+
+NAMESPACE_END(NS_DETAIL)
+
+// A monotonic arena with an inline initial buffer, falls back to upstream resource when it is used up.
+// Everything allocated from it is freed at once by release() or destruction.
+template<std::size_t InitialSize = 4096>
+class arena
+	: private NS_DETAIL::ArenaBuffer<InitialSize>
+	, public std::pmr::monotonic_buffer_resource
+{
+	using BufferBase = NS_DETAIL::ArenaBuffer<InitialSize>;
+public:
+	inline static constexpr const std::size_t initial_size = InitialSize;
+
+	explicit arena(std::pmr::memory_resource* upstream = std::pmr::get_default_resource())
+		: std::pmr::monotonic_buffer_resource(BufferBase::buffer, InitialSize, upstream) {}
+
+	arena(const arena&) = delete;
+	arena& operator=(const arena&) = delete;
+};
+
+NAMESPACE_BEGIN(NS_DETAIL)
+
+// Writes bytes into a std::vector<std::byte>
+struct VectorSink
+{
+	std::vector<std::byte>& out;
+
+	void write(const void* data, std::size_t size)
+	{
+		if (size == 0)
+			return;
+		// Reserve separately from the copy, inserting with a reallocation
+		// trips a false -Wstringop-overflow in GCC 12 at -O3.
+		if (out.capacity() - out.size() < size)
+			out.reserve(std::max(out.capacity() * 2, out.size() + size));
+		const auto offset = out.size();
+		out.resize(offset + size);
+		std::memcpy(out.data() + offset, data, size);
+	}
+};
+
+template<typename Sink>
+struct Encoder
+{
+	Sink& sink;
+
+	template<typename T>
+	void encode(const T& value)
+	{
+		if constexpr (is_projection_v<T>)
+			for_each_member(value, *this);
+		else if constexpr (reflectable<T>)
+			for_each_member(&value, *this);
+		else if constexpr (serializable_sequence<T>)
+		{
+			if (value.size() > std::numeric_limits<serialize_size_t>::max())
+				throw std::length_error("serialize: sequence is too long for its length prefix");
+			const auto size = static_cast<serialize_size_t>(value.size());
+			sink.write(&size, sizeof(size));
+			using Elem = typename T::value_type;
+			if constexpr (std::is_trivially_copyable_v<Elem> && !reflectable<Elem>)
+				sink.write(value.data(), value.size() * sizeof(Elem));
+			else
+				for (const auto& elem : value) encode(elem);
+		}
+		else
+		{
+			static_assert(std::is_trivially_copyable_v<T>, "type can not be serialized");
+			sink.write(&value, sizeof(T));
+		}
+	}
+
+	// for_each_member visitor
+	template<typename Cls, typename StringT, typename Member>
+	void operator()(Cls*, StringT, Member& member)
+	{
+		if constexpr (!std::is_member_function_pointer_v<std::remove_cv_t<Member>>)
+			encode(member);
+	}
+};
+
+struct Decoder
+{
+	std::span<const std::byte> in;
+	std::pmr::memory_resource* resource = nullptr;
+	bool ok = true;
+
+	bool read(void* data, std::size_t size)
+	{
+		if (!ok || in.size() < size)
+			return ok = false;
+		std::memcpy(data, in.data(), size);
+		in = in.subspan(size);
+		return true;
+	}
+
+	template<typename T>
+	void decode(T& value)
+	{
+		if constexpr (is_projection_v<T>)
+			for_each_member(value, *this);
+		else if constexpr (reflectable<T>)
+			for_each_member(&value, *this);
+		else if constexpr (serializable_sequence<T>)
+		{
+			serialize_size_t size = 0;
+			if (!read(&size, sizeof(size)))
+				return;
+
+			// Rebind container to the resource, so itself and everything it holds
+			// (strings in vector, for example) are allocated from it.
+			if constexpr (pmr_container<T>)
+			{
+				if (resource != nullptr && value.get_allocator().resource() != resource)
+				{
+					std::destroy_at(&value);
+					std::construct_at(&value, typename T::allocator_type{ resource });
+				}
+			}
+
+			using Elem = typename T::value_type;
+			if constexpr (std::is_trivially_copyable_v<Elem> && !reflectable<Elem>)
+			{
+				if (in.size() / sizeof(Elem) < size)
+				{
+					ok = false;
+					return;
+				}
+				value.resize(size);
+				read(value.data(), size * sizeof(Elem));
+			}
+			else
+			{
+				// size is untrusted, every element takes at least min_encoded_size bytes
+				constexpr std::size_t elem_size = min_encoded_size<Elem>();
+				if (elem_size != 0 && in.size() / elem_size < size)
+				{
+					ok = false;
+					return;
+				}
+				value.clear();
+				value.reserve(std::min<std::size_t>(size, in.size()));
+				for (serialize_size_t i = 0; i < size && ok; ++i)
+					decode(value.emplace_back());
+			}
+		}
+		else
+		{
+			static_assert(std::is_trivially_copyable_v<T>, "type can not be deserialized");
+			read(&value, sizeof(T));
+		}
+	}
+
+	// for_each_member visitor
+	template<typename Cls, typename StringT, typename Member>
+	void operator()(Cls*, StringT, Member& member)
+	{
+		if constexpr (!std::is_member_function_pointer_v<Member>)
+			decode(member);
+	}
+};
+
+NAMESPACE_END(NS_DETAIL)
+
+// Append serialized obj to out.
+template<reflectable Cls>
+void serialize(const Cls& obj, std::vector<std::byte>& out)
+{
+	NS_DETAIL::VectorSink sink{ out };
+	NS_DETAIL::Encoder<NS_DETAIL::VectorSink>{ sink }.encode(obj);
+}
+
+template<reflectable Cls>
+std::vector<std::byte> serialize(const Cls& obj)
+{
+	std::vector<std::byte> out;
+	serialize(obj, out);
+	return out;
+}
+
+// Serialize only the members selected by a projection, see Reflect::project.
+template<typename Subset, typename Cls>
+void serialize(projection<Subset, Cls> proj, std::vector<std::byte>& out)
+{
+	NS_DETAIL::VectorSink sink{ out };
+	NS_DETAIL::Encoder<NS_DETAIL::VectorSink>{ sink }.encode(proj);
+}
+
+template<typename Subset, typename Cls>
+std::vector<std::byte> serialize(projection<Subset, Cls> proj)
+{
+	std::vector<std::byte> out;
+	serialize(proj, out);
+	return out;
+}
+
+// Deserialize obj from in, returns the number of bytes consumed, or 0 if in is malformed.
+// If resource is not null, every std::pmr container in the object graph (including nested
+// reflectable members and elements of containers) is rebound to and allocated from it.
+// Members using other allocators are not affected.
+template<reflectable Cls>
+std::size_t deserialize(std::span<const std::byte> in, Cls& obj, std::pmr::memory_resource* resource = nullptr)
+{
+	NS_DETAIL::Decoder decoder{ in, resource };
+	decoder.decode(obj);
+	return decoder.ok ? in.size() - decoder.in.size() : 0;
+}
+
+// Deserialize only the members selected by a projection, other members are left untouched.
+template<typename Subset, typename Cls>
+	requires (!std::is_const_v<Cls>)
+std::size_t deserialize(std::span<const std::byte> in, projection<Subset, Cls> proj, std::pmr::memory_resource* resource = nullptr)
+{
+	NS_DETAIL::Decoder decoder{ in, resource };
+	decoder.decode(proj);
+	return decoder.ok ? in.size() - decoder.in.size() : 0;
+}
+
+NAMESPACE_END(NS_REFLECT)
+
+#endif //! __SIMPLE_REFLECT_SERIALIZE_HEADER__
@@ -0,0 +1,413 @@
+#ifndef __SIMPLE_REFLECT_SHM_CHANNEL_HEADER__
+#define __SIMPLE_REFLECT_SHM_CHANNEL_HEADER__
+
+#if !defined(__unix__) && !defined(__APPLE__)
+#error "shm_channel requires POSIX shared memory"
+#endif
+
+#include <bit>
+#include <new>
+#include <atomic>
+#include <limits>
+#include <memory>
+#include <string>
+#include <cstdint>
+#include <cstring>
+#include <utility>
+#include <algorithm>
+#include <stdexcept>
+#include <system_error>
+
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include "Reflect.hpp"
+
+NAMESPACE_BEGIN(NS_REFLECT)
+
+NAMESPACE_BEGIN(NS_DETAIL)
+
+constexpr std::uint64_t fnv1a(std::uint64_t hash, const void* data, std::size_t size) noexcept
+{
+	const auto* bytes = static_cast<const unsigned char*>(data);
+	for (std::size_t i = 0; i < size; ++i) {
+		hash ^= bytes[i];
+		hash *= 0x100000001b3ull;
+	}
+	return hash;
+}
+
+template<typename T>
+constexpr std::uint64_t fnv1a(std::uint64_t hash, const T& value) noexcept
+{ return fnv1a(hash, std::addressof(value), sizeof(T)); }
+
+template<typename T>
+std::uint64_t schema_hash_impl() noexcept;
+
+// for_each_member visitor, mixes name, type, offset and size of each data member.
+struct SchemaHasher
+{
+	const void* object;
+	std::uint64_t hash;
+
+	template<typename Cls, typename StringT, typename Member>
+	void operator()(Cls*, StringT name, Member& member) noexcept
+	{
+		if constexpr (!std::is_member_function_pointer_v<std::remove_cv_t<Member>>)
+		{
+			const std::uint64_t offset = reinterpret_cast<const std::byte*>(std::addressof(member))
+				- reinterpret_cast<const std::byte*>(object);
+			hash = fnv1a(hash, name.data(), name.size() * sizeof(typename StringT::value_type));
+			hash = fnv1a(hash, schema_hash_impl<std::remove_cv_t<Member>>());
+			hash = fnv1a(hash, offset);
+		}
+	}
+};
+
+template<typename T>
+std::uint64_t schema_hash_impl() noexcept
+{
+	std::uint64_t hash = fnv1a(type_id_v<T>, std::uint64_t{ sizeof(T) });
+	hash = fnv1a(hash, std::uint64_t{ alignof(T) });
+	if constexpr (std::is_array_v<T>)
+		hash = fnv1a(hash, schema_hash_impl<std::remove_cv_t<std::remove_all_extents_t<T>>>());
+	else if constexpr (reflectable<T>)
+	{
+		T obj{};
+		SchemaHasher hasher{ std::addressof(obj), hash };
+		for_each_member(&obj, hasher);
+		hash = hasher.hash;
+	}
+	return hash;
+}
+
+NAMESPACE_END(NS_DETAIL)
+
+// Hash of the memory layout of T: its type name, size and alignment, and the name,
+// type, offset and size of each reflected data member, recursively.
+// Two programs that agree on schema_hash can exchange T by copying bytes.
+template<typename T>
+	requires std::is_default_constructible_v<T>
+std::uint64_t schema_hash() noexcept
+{
+	static const std::uint64_t hash = NS_DETAIL::schema_hash_impl<T>();
+	return hash;
+}
+
+// Cls can be shared between processes as raw bytes.
+template<typename Cls>
+concept shm_compatible = reflectable<Cls> && std::is_trivially_copyable_v<Cls>
+	&& std::is_standard_layout_v<Cls> && std::is_default_constructible_v<Cls>;
+
+NAMESPACE_BEGIN(NS_DETAIL)
+
+static_assert(std::atomic<std::uint64_t>::is_always_lock_free && std::atomic<std::uint32_t>::is_always_lock_free,
+	"shm_channel needs lock-free atomics to share them between processes");
+
+// Placed at the beginning of the shared memory object, records follow it.
+struct ShmChannelHeader
+{
+	inline static constexpr const std::uint64_t magic_value = 0x314E4843'4D485352ull; // "SRSHMCH1"
+
+	std::uint64_t magic;
+	std::atomic<std::uint32_t> ready;
+	std::uint32_t type_name_size;
+	std::uint64_t type_id;
+	std::uint64_t schema;
+	std::uint64_t record_size;
+	std::uint64_t capacity;
+	char type_name[256];
+
+	// Producer and consumer indices are on separate cache lines, both only increase.
+	alignas(64) std::atomic<std::uint64_t> head;
+	alignas(64) std::atomic<std::uint64_t> tail;
+};
+
+inline std::system_error shm_system_error(const char* what, const std::string& name)
+{ return std::system_error{ errno, std::generic_category(), std::string{ what } + " " + name }; }
+
+NAMESPACE_END(NS_DETAIL)
+
+// A single producer, single consumer lock-free ring of Cls records in POSIX shared memory,
+// for processes on the same machine. One process creates the channel, the other opens it by name.
+// The header holds type_id_v<Cls> and schema_hash<Cls>(), opening a channel created for a
+// different type or layout throws.
+// Records are written and read in place: try_prepare / commit on the producer side,
+// try_front / pop (or consume) on the consumer side, no copies are made.
+template<shm_compatible Cls>
+class shm_channel
+{
+	using Header = NS_DETAIL::ShmChannelHeader;
+
+	inline static constexpr const std::size_t records_offset =
+		(sizeof(Header) + alignof(Cls) - 1) / alignof(Cls) * alignof(Cls);
+public:
+	using value_type = Cls;
+	using size_type  = std::size_t;
+
+	shm_channel() = default;
+
+	shm_channel(shm_channel&& other) noexcept
+	{ swap(other); }
+
+	shm_channel& operator=(shm_channel&& other) noexcept
+	{
+		shm_channel{ std::move(other) }.swap(*this);
+		return *this;
+	}
+
+	~shm_channel()
+	{
+		if (header != nullptr)
+			::munmap(header, mapped_size);
+	}
+
+	// Create a channel holding up to capacity records, rounded up to a power of two.
+	// name is a POSIX shared memory name like "/quotes". Throws std::system_error (std::errc::file_exists)
+	// if it already exists, a stale channel left by a previous run has to be removed by unlink first.
+	// The name stays until unlink is called, even after both sides closed the channel.
+	static shm_channel create(const std::string& name, size_type capacity)
+	{
+		size_type rounded = 1;
+		while (rounded < capacity)
+			rounded *= 2;
+
+		const int fd = ::shm_open(name.c_str(), O_CREAT | O_EXCL | O_RDWR, 0600);
+		if (fd < 0)
+			throw NS_DETAIL::shm_system_error("shm_open", name);
+
+		const size_type size = records_offset + rounded * sizeof(Cls);
+		if (::ftruncate(fd, static_cast<off_t>(size)) != 0)
+		{
+			auto error = NS_DETAIL::shm_system_error("ftruncate", name);
+			::close(fd);
+			::shm_unlink(name.c_str());
+			throw error;
+		}
+
+		shm_channel channel;
+		try
+		{
+			channel.map(fd, size, name);
+		}
+		catch (...)
+		{
+			::shm_unlink(name.c_str());
+			throw;
+		}
+
+		auto* header = new (channel.header) Header{};
+		header->magic       = Header::magic_value;
+		header->type_id     = type_id_v<Cls>;
+		header->schema      = schema_hash<Cls>();
+		header->record_size = sizeof(Cls);
+		header->capacity    = rounded;
+		header->type_name_size = static_cast<std::uint32_t>(std::min(type_name_v<Cls>.size(), sizeof(header->type_name)));
+		std::memcpy(header->type_name, type_name_v<Cls>.data(), header->type_name_size);
+		header->ready.store(1, std::memory_order_release);
+
+		channel.init(rounded);
+		return channel;
+	}
+
+	// Open a channel created by another process.
+	// Throws std::system_error if it doesn't exist or is not initialized yet,
+	// and std::runtime_error if it was created for a different type or layout,
+	// or its capacity is not a power of two that fits into the shared memory object.
+	static shm_channel open(const std::string& name)
+	{
+		const int fd = ::shm_open(name.c_str(), O_RDWR, 0);
+		if (fd < 0)
+			throw NS_DETAIL::shm_system_error("shm_open", name);
+
+		struct stat st{};
+		if (::fstat(fd, &st) != 0)
+		{
+			auto error = NS_DETAIL::shm_system_error("fstat", name);
+			::close(fd);
+			throw error;
+		}
+		if (static_cast<size_type>(st.st_size) < records_offset)
+		{
+			// the creator has not set the size yet
+			::close(fd);
+			errno = EAGAIN;
+			throw NS_DETAIL::shm_system_error("open shm_channel", name);
+		}
+
+		shm_channel channel;
+		channel.map(fd, static_cast<size_type>(st.st_size), name);
+
+		const auto* header = channel.header;
+		if (header->ready.load(std::memory_order_acquire) == 0)
+		{
+			errno = EAGAIN;
+			throw NS_DETAIL::shm_system_error("open shm_channel", name);
+		}
+		if (header->magic != Header::magic_value
+			|| header->type_id != type_id_v<Cls>
+			|| header->schema  != schema_hash<Cls>()
+			|| header->record_size != sizeof(Cls))
+		{
+			throw std::runtime_error(
+				"shm_channel " + name + " was created for " + std::string{ header->type_name, header->type_name_size }
+				+ " with a different layout than " + std::string{ type_name_v<Cls> }
+			);
+		}
+		if (!valid_capacity(header->capacity, channel.mapped_size))
+			throw std::runtime_error("shm_channel " + name + " has an invalid capacity");
+
+		channel.init(header->capacity);
+		return channel;
+	}
+
+	// Remove the name, channels that are already open keep working.
+	static void unlink(const std::string& name) noexcept
+	{ ::shm_unlink(name.c_str()); }
+
+	// Producer side.
+	// Slot of the next record, or nullptr if the ring is full.
+	// The record is visible to the consumer after commit.
+	Cls* try_prepare() noexcept
+	{
+		if (head - cached_tail == capacity())
+		{
+			cached_tail = header->tail.load(std::memory_order_acquire);
+			if (head - cached_tail == capacity())
+				return nullptr;
+		}
+		return &records[head & mask];
+	}
+
+	void commit() noexcept
+	{ header->head.store(++head, std::memory_order_release); }
+
+	// Copy msg into the ring, returns false if it's full.
+	bool try_push(const Cls& msg) noexcept
+	{
+		auto* slot = try_prepare();
+		if (slot == nullptr)
+			return false;
+		std::memcpy(static_cast<void*>(slot), std::addressof(msg), sizeof(Cls));
+		commit();
+		return true;
+	}
+
+	// Consumer side.
+	// Next record in place, or nullptr if the ring is empty.
+	// It stays valid until pop.
+	const Cls* try_front() noexcept
+	{
+		if (tail == cached_head)
+		{
+			cached_head = header->head.load(std::memory_order_acquire);
+			if (tail == cached_head)
+				return nullptr;
+		}
+		return &records[tail & mask];
+	}
+
+	void pop() noexcept
+	{ header->tail.store(++tail, std::memory_order_release); }
+
+	// Copy the next record into out, returns false if the ring is empty.
+	bool try_pop(Cls& out) noexcept
+	{
+		const auto* record = try_front();
+		if (record == nullptr)
+			return false;
+		std::memcpy(std::addressof(out), record, sizeof(Cls));
+		pop();
+		return true;
+	}
+
+	// Call func(const Cls&) for up to max available records in place, then release all of them at once.
+	// Returns the number of records consumed.
+	template<typename Func>
+		requires std::invocable<Func&, const Cls&>
+	size_type consume(Func&& func, size_type max = (size_type)-1)
+	{
+		cached_head = header->head.load(std::memory_order_acquire);
+		const auto count = std::min<size_type>(cached_head - tail, max);
+		for (size_type i = 0; i < count; ++i)
+			func(std::as_const(records[(tail + i) & mask]));
+		if (count != 0)
+		{
+			tail += count;
+			header->tail.store(tail, std::memory_order_release);
+		}
+		return count;
+	}
+
+	size_type capacity() const noexcept { return mask + 1; }
+
+	// Number of records in the ring, may be outdated immediately.
+	size_type size() const noexcept
+	{
+		return header->head.load(std::memory_order_acquire)
+			- header->tail.load(std::memory_order_acquire);
+	}
+
+	bool is_open() const noexcept { return header != nullptr; }
+
+	void swap(shm_channel& other) noexcept
+	{
+		std::swap(header, other.header);
+		std::swap(records, other.records);
+		std::swap(mapped_size, other.mapped_size);
+		std::swap(mask, other.mask);
+		std::swap(head, other.head);
+		std::swap(tail, other.tail);
+		std::swap(cached_head, other.cached_head);
+		std::swap(cached_tail, other.cached_tail);
+	}
+
+private:
+	void map(int fd, size_type size, const std::string& name)
+	{
+		void* ptr = ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+		if (ptr == MAP_FAILED)
+		{
+			auto error = NS_DETAIL::shm_system_error("mmap", name);
+			::close(fd);
+			throw error;
+		}
+		::close(fd);
+		header = static_cast<Header*>(ptr);
+		records = reinterpret_cast<Cls*>(static_cast<std::byte*>(ptr) + records_offset);
+		mapped_size = size;
+	}
+
+	// capacity is read from the shared header, the ring must fit into the mapping.
+	static bool valid_capacity(std::uint64_t capacity, size_type mapped_size) noexcept
+	{
+		if (!std::has_single_bit(capacity) || capacity > (std::numeric_limits<size_type>::max() - records_offset) / sizeof(Cls))
+			return false;
+		return records_offset + static_cast<size_type>(capacity) * sizeof(Cls) <= mapped_size;
+	}
+
+	void init(size_type capacity) noexcept
+	{
+		mask = capacity - 1;
+		head = cached_head = header->head.load(std::memory_order_acquire);
+		tail = cached_tail = header->tail.load(std::memory_order_acquire);
+	}
+
+	Header* header = nullptr;
+	Cls* records = nullptr;
+	size_type mapped_size = 0;
+	size_type mask = 0;
+
+	// Local copies of indices, each side only reloads the other side's index
+	// when the ring looks full (producer) or empty (consumer).
+	std::uint64_t head = 0;
+	std::uint64_t tail = 0;
+	std::uint64_t cached_head = 0;
+	std::uint64_t cached_tail = 0;
+};
+
+NAMESPACE_END(NS_REFLECT)
+
+#endif //! __SIMPLE_REFLECT_SHM_CHANNEL_HEADER__
@@ -0,0 +1,265 @@
+#ifndef __SIMPLE_REFLECT_SORT_HEADER__
+#define __SIMPLE_REFLECT_SORT_HEADER__
+
+#include <bit>
+#include <span>
+#include <array>
+#include <tuple>
+#include <limits>
+#include <thread>
+#include <vector>
+#include <cstdint>
+#include <utility>
+#include <algorithm>
+
+#include "Reflect.hpp"
+
+NAMESPACE_BEGIN(NS_REFLECT)
+
+NAMESPACE_BEGIN(NS_DETAIL)
+
+template<reflectable Cls, StaticString Name>
+using SortKeyType = std::remove_cvref_t<decltype(get_member<Name>(std::declval<Cls&>()))>;
+
+// Keys that can be mapped to an unsigned integer with the same order.
+template<typename T>
+concept radix_key = std::is_integral_v<T> || std::is_enum_v<T> ||
+	(std::is_floating_point_v<T> && std::numeric_limits<T>::is_iec559 && (sizeof(T) == 4 || sizeof(T) == 8));
+
+template<typename T>
+using RadixBits = std::conditional_t<sizeof(T) <= 4, std::uint32_t, std::uint64_t>;
+
+template<radix_key T>
+constexpr RadixBits<T> radix_bits(T value) noexcept
+{
+	using Bits = RadixBits<T>;
+	if constexpr (std::is_enum_v<T>)
+		return radix_bits(static_cast<std::underlying_type_t<T>>(value));
+	else if constexpr (std::is_floating_point_v<T>)
+	{
+		using Raw = std::conditional_t<sizeof(T) == 4, std::uint32_t, std::uint64_t>;
+		constexpr Raw sign = Raw{ 1 } << (sizeof(T) * 8 - 1);
+		const auto raw = std::bit_cast<Raw>(value);
+		// negative numbers are flipped entirely, positive ones only get the sign bit set
+		return static_cast<Bits>((raw & sign) ? ~raw : (raw | sign));
+	}
+	else if constexpr (std::is_signed_v<T>)
+	{
+		using Unsigned = std::make_unsigned_t<T>;
+		constexpr Unsigned sign = Unsigned{ 1 } << (sizeof(T) * 8 - 1);
+		return static_cast<Bits>(static_cast<Unsigned>(value) ^ sign);
+	}
+	else
+		return static_cast<Bits>(value);
+}
+
+template<typename Bits>
+struct RadixItem
+{
+	Bits key;
+	std::uint32_t index;
+};
+
+// Stable LSD radix sort on 8-bit digits, bytes that are equal for all items are skipped.
+// Result is in items, temp is used as the second buffer.
+template<typename Bits>
+void radix_sort(std::vector<RadixItem<Bits>>& items, std::vector<RadixItem<Bits>>& temp, std::size_t key_size)
+{
+	std::array<std::array<std::size_t, 256>, sizeof(Bits)> histograms{};
+	for (const auto& item : items) {
+		for (std::size_t byte = 0; byte < key_size; ++byte)
+			++histograms[byte][(item.key >> (byte * 8)) & 0xff];
+	}
+
+	temp.resize(items.size());
+	for (std::size_t byte = 0; byte < key_size; ++byte)
+	{
+		auto& histogram = histograms[byte];
+		if (std::ranges::find(histogram, items.size()) != histogram.end())
+			continue;
+
+		std::size_t offset = 0;
+		for (auto& count : histogram)
+			offset += std::exchange(count, offset);
+		for (const auto& item : items)
+			temp[histogram[(item.key >> (byte * 8)) & 0xff]++] = item;
+		items.swap(temp);
+	}
+}
+
+template<reflectable Cls, StaticString Name>
+void radix_sort_key(std::span<const Cls> data, std::vector<std::uint32_t>& order)
+{
+	using Key  = SortKeyType<Cls, Name>;
+	using Bits = RadixBits<Key>;
+
+	std::vector<RadixItem<Bits>> items(order.size());
+	std::vector<RadixItem<Bits>> temp;
+	for (std::size_t i = 0; i < order.size(); ++i)
+		items[i] = { radix_bits(get_member<Name>(data[order[i]])), order[i] };
+
+	radix_sort(items, temp, sizeof(Key));
+	for (std::size_t i = 0; i < order.size(); ++i)
+		order[i] = items[i].index;
+}
+
+// LSD radix sort is stable, sorting from the last key to the first one gives lexical order.
+template<reflectable Cls, StaticString First, StaticString ...Rest>
+void radix_sort_keys(std::span<const Cls> data, std::vector<std::uint32_t>& order)
+{
+	if constexpr (sizeof...(Rest) > 0)
+		radix_sort_keys<Cls, Rest...>(data, order);
+	radix_sort_key<Cls, First>(data, order);
+}
+
+// Moves data[order[i]] to data[i] in place, one cycle of the permutation at a time.
+// order is consumed, finished positions are marked by order[i] == i.
+template<typename T>
+void apply_order(std::span<T> data, std::vector<std::uint32_t>& order)
+{
+	for (std::size_t start = 0; start < data.size(); ++start)
+	{
+		if (order[start] == start)
+			continue;
+
+		T value = std::move(data[start]);
+		std::size_t current = start;
+		for (std::size_t next = order[current]; next != start; next = order[current])
+		{
+			data[current] = std::move(data[next]);
+			order[current] = static_cast<std::uint32_t>(current);
+			current = next;
+		}
+		data[current] = std::move(value);
+		order[current] = static_cast<std::uint32_t>(current);
+	}
+}
+
+template<reflectable Cls, StaticString ...Keys>
+inline constexpr bool radix_sortable = (radix_key<SortKeyType<Cls, Keys>> && ...);
+
+// Compares keys in order, radix keys are compared the same way radix sort orders them.
+template<reflectable Cls, StaticString ...Keys>
+struct KeyLess
+{
+	template<StaticString Name>
+	static constexpr decltype(auto) key_of(const Cls& obj)
+	{
+		if constexpr (radix_key<SortKeyType<Cls, Name>>)
+			return radix_bits(get_member<Name>(obj));
+		else
+			return static_cast<const SortKeyType<Cls, Name>&>(get_member<Name>(obj));
+	}
+
+	constexpr bool operator()(const Cls& lhs, const Cls& rhs) const
+	{
+		using Tuple = std::tuple<decltype(key_of<Keys>(lhs))...>;
+		return Tuple{ key_of<Keys>(lhs)... } < Tuple{ key_of<Keys>(rhs)... };
+	}
+};
+
+// Radix sort has a fixed cost for its histograms and buffers, std::sort is faster on small inputs
+// unless the records are large, then moving each of them once (instead of log n times) wins.
+inline constexpr std::size_t radix_min_size = 4096;
+inline constexpr std::size_t radix_min_size_large = 64;
+inline constexpr std::size_t radix_large_record = 256;
+
+template<typename Cls>
+constexpr bool use_radix_sort(std::size_t size) noexcept
+{
+	if (size > std::numeric_limits<std::uint32_t>::max())
+		return false;
+	return size >= (sizeof(Cls) >= radix_large_record ? radix_min_size_large : radix_min_size);
+}
+
+template<StaticString ...Keys, reflectable Cls>
+void sort_by_impl(std::span<Cls> data)
+{
+	if constexpr (radix_sortable<Cls, Keys...>)
+	{
+		if (use_radix_sort<Cls>(data.size()))
+		{
+			std::vector<std::uint32_t> order(data.size());
+			for (std::uint32_t i = 0; i < order.size(); ++i)
+				order[i] = i;
+
+			radix_sort_keys<Cls, Keys...>(data, order);
+			apply_order(data, order);
+			return;
+		}
+	}
+	std::sort(data.begin(), data.end(), KeyLess<Cls, Keys...>{});
+}
+
+NAMESPACE_END(NS_DETAIL)
+
+// Sort data by reflected members Keys, lexicographically.
+// If every key is an integral, enum or floating point member and data is not small, (key, index)
+// pairs are sorted by a radix sort, then elements are moved into place along the cycles of the
+// permutation. Otherwise std::sort is used with a comparator generated from Keys.
+// The radix sort is stable, std::sort is not. If the order of equal elements matters,
+// add a unique member as the last key.
+// Floating point keys are ordered by their bits: -0.0 < 0.0, and NaNs at the ends.
+template<StaticString ...Keys, reflectable Cls>
+	requires (sizeof...(Keys) > 0)
+void sort_by(std::span<Cls> data)
+{ NS_DETAIL::sort_by_impl<Keys...>(data); }
+
+template<StaticString ...Keys, reflectable Cls>
+	requires (sizeof...(Keys) > 0)
+void sort_by(std::vector<Cls>& data)
+{ sort_by<Keys...>(std::span<Cls>{ data }); }
+
+// Parallel version of sort_by, data is split into thread_count parts that are sorted
+// concurrently, then merged. Inputs smaller than min_parallel_size are sorted by sort_by.
+template<StaticString ...Keys, reflectable Cls>
+	requires (sizeof...(Keys) > 0)
+void parallel_sort_by(
+	std::span<Cls> data,
+	std::size_t thread_count = std::thread::hardware_concurrency(),
+	std::size_t min_parallel_size = 1 << 16)
+{
+	thread_count = std::bit_floor(std::clamp<std::size_t>(thread_count, 1, data.size() / 2 + 1));
+	if (thread_count <= 1 || data.size() < min_parallel_size)
+		return sort_by<Keys...>(data);
+
+	std::vector<std::size_t> bounds(thread_count + 1);
+	for (std::size_t i = 0; i <= thread_count; ++i)
+		bounds[i] = data.size() * i / thread_count;
+
+	const auto run = [&](std::size_t parts, auto&& job) {
+		std::vector<std::jthread> threads;
+		threads.reserve(parts);
+		for (std::size_t i = 0; i < parts; ++i)
+			threads.emplace_back(job, i);
+	};
+
+	run(thread_count, [&](std::size_t i) {
+		sort_by<Keys...>(data.subspan(bounds[i], bounds[i + 1] - bounds[i]));
+	});
+
+	for (std::size_t step = 1; step < thread_count; step *= 2)
+	{
+		run(thread_count / (step * 2), [&](std::size_t i) {
+			const auto first  = bounds[i * step * 2];
+			const auto middle = bounds[i * step * 2 + step];
+			const auto last   = bounds[i * step * 2 + step * 2];
+			std::inplace_merge(
+				data.begin() + first, data.begin() + middle, data.begin() + last,
+				NS_DETAIL::KeyLess<Cls, Keys...>{}
+			);
+		});
+	}
+}
+
+template<StaticString ...Keys, reflectable Cls>
+	requires (sizeof...(Keys) > 0)
+void parallel_sort_by(
+	std::vector<Cls>& data,
+	std::size_t thread_count = std::thread::hardware_concurrency(),
+	std::size_t min_parallel_size = 1 << 16)
+{ parallel_sort_by<Keys...>(std::span<Cls>{ data }, thread_count, min_parallel_size); }
+
+NAMESPACE_END(NS_REFLECT)
+
+#endif //! __SIMPLE_REFLECT_SORT_HEADER__
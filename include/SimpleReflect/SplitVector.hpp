@@ -0,0 +1,284 @@
+#ifndef __SIMPLE_REFLECT_SPLIT_VECTOR_HEADER__
+#define __SIMPLE_REFLECT_SPLIT_VECTOR_HEADER__
+
+#include <array>
+#include <span>
+#include <tuple>
+#include <vector>
+#include <iterator>
+
+#include "Reflect.hpp"
+
+NAMESPACE_BEGIN(NS_REFLECT)
+
+template<reflectable Cls>
+class split_vector;
+
+NAMESPACE_BEGIN(NS_DETAIL)
+
+template<reflectable Cls>
+struct SplitLayout
+{
+	template<std::size_t Index>
+	using Info = InfoTupleElem<Cls, Index>;
+
+	template<std::size_t Index>
+	using Member = std::remove_cv_t<typename Info<Index>::member_type>;
+
+	template<bool Cold, std::size_t ...Indices>
+	static constexpr std::size_t count_of(std::index_sequence<Indices...>) noexcept
+	{
+		return ((!Info<Indices>::is_function_pointer && Info<Indices>::is_cold == Cold) + ... + 0);
+	}
+
+	// Indices of reflected data members, that are (not) marked cold.
+	template<bool Cold, std::size_t ...Indices>
+	static constexpr auto indices_of(std::index_sequence<Indices...> seq) noexcept
+	{
+		constexpr bool selected[] = { (!Info<Indices>::is_function_pointer && Info<Indices>::is_cold == Cold)..., false };
+		std::array<std::size_t, count_of<Cold>(seq)> result{};
+		for (std::size_t i = 0, n = 0; i < sizeof...(Indices); ++i) {
+			if (selected[i])
+				result[n++] = i;
+		}
+		return result;
+	}
+
+	using Sequence = std::make_index_sequence<member_count_v<Cls>>;
+	inline static constexpr const auto hot_indices  = indices_of<false>(Sequence{});
+	inline static constexpr const auto cold_indices = indices_of<true >(Sequence{});
+
+	template<const auto& Indices, std::size_t ...J>
+	static auto make_storage(std::index_sequence<J...>) -> std::tuple<Member<Indices[J]>...>;
+
+	using HotStorage  = decltype(make_storage<hot_indices >(std::make_index_sequence<hot_indices .size()>{}));
+	using ColdStorage = decltype(make_storage<cold_indices>(std::make_index_sequence<cold_indices.size()>{}));
+
+	// position of member Index in hot or cold storage
+	template<std::size_t Index>
+	static constexpr std::size_t position() noexcept
+	{
+		if constexpr (Info<Index>::is_cold)
+			return std::ranges::find(cold_indices, Index) - cold_indices.begin();
+		else
+			return std::ranges::find(hot_indices, Index) - hot_indices.begin();
+	}
+
+	template<std::size_t Index, typename Hot, typename Cold>
+	static auto& get(Hot& hot, Cold& cold) noexcept
+	{
+		if constexpr (Info<Index>::is_cold)
+			return std::get<position<Index>()>(cold);
+		else
+			return std::get<position<Index>()>(hot);
+	}
+
+	// built-in arrays can not be assigned
+	template<typename T>
+	static void assign(T& dst, const T& src)
+	{
+		if constexpr (std::is_array_v<T>)
+			std::ranges::copy(src, std::ranges::begin(dst));
+		else
+			dst = src;
+	}
+
+	template<const auto& Indices, typename Storage, std::size_t ...J>
+	static void split(const Cls& obj, Storage& storage, std::index_sequence<J...>)
+	{
+		(assign(std::get<J>(storage), member_info<Cls, Indices[J]>().to_real_variable(&obj)), ...);
+	}
+
+	template<const auto& Indices, typename Storage, std::size_t ...J>
+	static void merge(Cls& obj, const Storage& storage, std::index_sequence<J...>)
+	{
+		(assign(member_info<Cls, Indices[J]>().to_real_variable(&obj), std::get<J>(storage)), ...);
+	}
+};
+
+NAMESPACE_END(NS_DETAIL)
+
+// Proxy of an element in split_vector, members are accessed by get_member.
+template<reflectable Cls, bool Const>
+class split_reference
+{
+	using Layout = NS_DETAIL::SplitLayout<Cls>;
+	using Hot  = std::conditional_t<Const, const typename Layout::HotStorage,  typename Layout::HotStorage>;
+	using Cold = std::conditional_t<Const, const typename Layout::ColdStorage, typename Layout::ColdStorage>;
+public:
+	split_reference(Hot& hot, Cold& cold) noexcept
+		: hot{ &hot }, cold{ &cold } {}
+
+	template<StaticString Name>
+		requires (member_index<Cls, Name>() < member_count_v<Cls>)
+	auto& get_member() const noexcept
+	{
+		constexpr std::size_t idx = member_index<Cls, Name>();
+		static_assert(!NS_DETAIL::InfoTupleElem<Cls, idx>::is_function_pointer, "split_vector only stores data members");
+		REFLECT_RECORD_ACCESS(Cls, idx);
+		return Layout::template get<idx>(*hot, *cold);
+	}
+
+	// Assemble a full object
+	Cls load() const
+	{
+		Cls obj{};
+		Layout::template merge<Layout::hot_indices >(obj, *hot,  std::make_index_sequence<Layout::hot_indices .size()>{});
+		Layout::template merge<Layout::cold_indices>(obj, *cold, std::make_index_sequence<Layout::cold_indices.size()>{});
+		return obj;
+	}
+
+	// Like load, lets split_vector iterators model std::forward_iterator
+	operator Cls() const
+	{ return load(); }
+
+	const split_reference& operator=(const Cls& obj) const
+		requires (!Const)
+	{
+		Layout::template split<Layout::hot_indices >(obj, *hot,  std::make_index_sequence<Layout::hot_indices .size()>{});
+		Layout::template split<Layout::cold_indices>(obj, *cold, std::make_index_sequence<Layout::cold_indices.size()>{});
+		return *this;
+	}
+
+private:
+	Hot*  hot;
+	Cold* cold;
+};
+
+template<StaticString Name, reflectable Cls, bool Const>
+auto& get_member(const split_reference<Cls, Const>& ref) noexcept
+{ return ref.template get_member<Name>(); }
+
+// A vector of Cls that stores members marked by REFLECT_MEMBER_COLD in a separate array,
+// so scanning hot members touches fewer cache lines. Elements are accessed through
+// split_reference proxies. Cls has to be default constructible, and its members assignable.
+template<reflectable Cls>
+class split_vector
+{
+	using Layout = NS_DETAIL::SplitLayout<Cls>;
+public:
+	using value_type      = Cls;
+	using size_type       = std::size_t;
+	using reference       = split_reference<Cls, false>;
+	using const_reference = split_reference<Cls, true>;
+	using hot_type        = typename Layout::HotStorage;
+	using cold_type       = typename Layout::ColdStorage;
+
+	// operator* returns a proxy, so this is only an input iterator for legacy algorithms.
+	template<bool Const>
+	class basic_iterator
+	{
+		using Owner = std::conditional_t<Const, const split_vector, split_vector>;
+	public:
+		using value_type        = Cls;
+		using difference_type   = std::ptrdiff_t;
+		using iterator_concept  = std::forward_iterator_tag;
+		using iterator_category = std::input_iterator_tag;
+
+		basic_iterator() = default;
+		basic_iterator(Owner* owner, size_type index) noexcept
+			: owner{ owner }, index{ index } {}
+
+		split_reference<Cls, Const> operator*() const noexcept
+		{ return (*owner)[index]; }
+
+		basic_iterator& operator++() noexcept
+		{
+			++index;
+			return *this;
+		}
+		basic_iterator operator++(int) noexcept
+		{
+			auto copy = *this;
+			++index;
+			return copy;
+		}
+
+		bool operator==(const basic_iterator& other) const noexcept
+		{ return index == other.index; }
+
+	private:
+		Owner* owner = nullptr;
+		size_type index = 0;
+	};
+
+	using iterator       = basic_iterator<false>;
+	using const_iterator = basic_iterator<true>;
+
+	void push_back(const Cls& obj)
+	{
+		hot.emplace_back();
+		if constexpr (has_cold)
+			cold.emplace_back();
+		(*this)[size() - 1] = obj;
+	}
+
+	reference operator[](size_type index) noexcept
+	{ return { hot[index], cold_at(index) }; }
+
+	const_reference operator[](size_type index) const noexcept
+	{ return { hot[index], cold_at(index) }; }
+
+	Cls load(size_type index) const
+	{ return (*this)[index].load(); }
+
+	size_type size()  const noexcept { return hot.size(); }
+	bool      empty() const noexcept { return hot.empty(); }
+
+	void reserve(size_type n)
+	{
+		hot.reserve(n);
+		if constexpr (has_cold)
+			cold.reserve(n);
+	}
+	void resize(size_type n)
+	{
+		hot.resize(n);
+		if constexpr (has_cold)
+			cold.resize(n);
+	}
+	void clear() noexcept
+	{
+		hot.clear();
+		cold.clear();
+	}
+
+	iterator begin() noexcept { return { this, 0 }; }
+	iterator end()   noexcept { return { this, size() }; }
+	const_iterator begin() const noexcept { return { this, 0 }; }
+	const_iterator end()   const noexcept { return { this, size() }; }
+
+	// Dense storage of hot and cold members, cold_data is empty if no member is marked cold
+	std::span<hot_type> hot_data() noexcept { return hot; }
+	std::span<const hot_type> hot_data() const noexcept { return hot; }
+	std::span<cold_type> cold_data() noexcept { return cold; }
+	std::span<const cold_type> cold_data() const noexcept { return cold; }
+
+private:
+	// Without cold members cold_type is an empty tuple, which is not stored per element.
+	inline static constexpr const bool has_cold = Layout::cold_indices.size() != 0;
+	inline static cold_type no_cold{};
+
+	cold_type& cold_at(size_type index) noexcept
+	{
+		if constexpr (has_cold)
+			return cold[index];
+		else
+			return no_cold;
+	}
+
+	const cold_type& cold_at(size_type index) const noexcept
+	{
+		if constexpr (has_cold)
+			return cold[index];
+		else
+			return no_cold;
+	}
+
+	std::vector<hot_type>  hot;
+	std::vector<cold_type> cold;
+};
+
+NAMESPACE_END(NS_REFLECT)
+
+#endif //! __SIMPLE_REFLECT_SPLIT_VECTOR_HEADER__
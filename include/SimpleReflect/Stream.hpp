@@ -0,0 +1,193 @@
+#ifndef __SIMPLE_REFLECT_STREAM_HEADER__
+#define __SIMPLE_REFLECT_STREAM_HEADER__
+
+#include <ranges>
+#include <utility>
+#include <algorithm>
+#include <iterator>
+#include <exception>
+#include <coroutine>
+
+#include "Serialize.hpp"
+
+NAMESPACE_BEGIN(NS_REFLECT)
+
+// A minimal single pass generator, until std::generator (C++23) is available.
+// Yielded values are only valid until the iterator is incremented.
+template<typename T>
+class generator
+{
+public:
+	struct promise_type
+	{
+		const T* current = nullptr;
+		std::exception_ptr exception;
+
+		generator get_return_object() noexcept
+		{ return generator{ std::coroutine_handle<promise_type>::from_promise(*this) }; }
+
+		std::suspend_always initial_suspend() const noexcept { return {}; }
+		std::suspend_always final_suspend() const noexcept { return {}; }
+
+		// value lives in the coroutine frame (or is a temporary of co_yield expression)
+		// until the coroutine is resumed.
+		std::suspend_always yield_value(const T& value) noexcept
+		{
+			current = std::addressof(value);
+			return {};
+		}
+
+		void return_void() const noexcept {}
+		void unhandled_exception() noexcept { exception = std::current_exception(); }
+		void await_transform() = delete;
+	};
+
+	class iterator
+	{
+	public:
+		using value_type      = T;
+		using difference_type = std::ptrdiff_t;
+
+		iterator() = default;
+		explicit iterator(std::coroutine_handle<promise_type> handle) noexcept
+			: handle{ handle } {}
+
+		const T& operator*() const noexcept
+		{ return *handle.promise().current; }
+
+		iterator& operator++()
+		{
+			resume(handle);
+			return *this;
+		}
+		void operator++(int)
+		{ ++*this; }
+
+		bool operator==(std::default_sentinel_t) const noexcept
+		{ return !handle || handle.done(); }
+
+	private:
+		std::coroutine_handle<promise_type> handle;
+	};
+
+	generator(generator&& other) noexcept
+		: handle{ std::exchange(other.handle, {}) } {}
+
+	generator& operator=(generator&& other) noexcept
+	{
+		if (this != &other)
+		{
+			if (handle)
+				handle.destroy();
+			handle = std::exchange(other.handle, {});
+		}
+		return *this;
+	}
+
+	~generator()
+	{
+		if (handle)
+			handle.destroy();
+	}
+
+	iterator begin()
+	{
+		resume(handle);
+		return iterator{ handle };
+	}
+
+	std::default_sentinel_t end() const noexcept
+	{ return {}; }
+
+private:
+	explicit generator(std::coroutine_handle<promise_type> handle) noexcept
+		: handle{ handle } {}
+
+	static void resume(std::coroutine_handle<promise_type> handle)
+	{
+		handle.resume();
+		if (handle.promise().exception)
+			std::rethrow_exception(std::exchange(handle.promise().exception, {}));
+	}
+
+	std::coroutine_handle<promise_type> handle;
+};
+
+NAMESPACE_BEGIN(NS_DETAIL)
+
+// Writes into a fixed size chunk. Bytes that do not fit are kept in overflow
+// until the chunk has been consumed, so the object being encoded does not have to
+// stop in the middle of for_each_member recursion.
+struct ChunkSink
+{
+	std::vector<std::byte> chunk;
+	std::size_t used = 0;
+	std::vector<std::byte> overflow;
+	std::size_t overflow_pos = 0;
+
+	explicit ChunkSink(std::size_t chunk_size)
+		: chunk(std::max<std::size_t>(chunk_size, 1)) {}
+
+	void write(const void* data, std::size_t size)
+	{
+		const auto* bytes = static_cast<const std::byte*>(data);
+		const auto count  = std::min(size, chunk.size() - used);
+		std::memcpy(chunk.data() + used, bytes, count);
+		used += count;
+		if (count < size)
+			overflow.insert(overflow.end(), bytes + count, bytes + size);
+	}
+
+	bool full() const noexcept
+	{ return used == chunk.size(); }
+
+	// Start a new chunk, refilled from overflow.
+	void next()
+	{
+		const auto count = std::min(chunk.size(), overflow.size() - overflow_pos);
+		std::memcpy(chunk.data(), overflow.data() + overflow_pos, count);
+		used = count;
+		overflow_pos += count;
+		if (overflow_pos == overflow.size())
+		{
+			overflow.clear(); // capacity is kept for later objects
+			overflow_pos = 0;
+		}
+	}
+};
+
+template<std::ranges::input_range View>
+generator<std::span<const std::byte>> serialize_stream_impl(View range, std::size_t chunk_size)
+{
+	ChunkSink sink{ chunk_size };
+	Encoder<ChunkSink> encoder{ sink };
+	for (const auto& obj : range)
+	{
+		encoder.encode(obj);
+		while (sink.full())
+		{
+			co_yield std::span<const std::byte>{ sink.chunk };
+			sink.next();
+		}
+	}
+	if (sink.used != 0)
+		co_yield std::span<const std::byte>{ sink.chunk.data(), sink.used };
+}
+
+NAMESPACE_END(NS_DETAIL)
+
+// Serialize each object of range, produce the same bytes as calling serialize on them one by one,
+// but split into chunks of chunk_size bytes (the last one may be shorter).
+// Encoding only advances when the next chunk is requested, and memory used is bounded by
+// chunk_size plus the size of the largest single object, regardless of number of objects.
+// Each chunk is only valid until the next one is requested. An lvalue range must outlive the generator.
+template<std::ranges::viewable_range Range>
+	requires reflectable<std::ranges::range_value_t<Range>>
+generator<std::span<const std::byte>> serialize_stream(Range&& range, std::size_t chunk_size = 64 * 1024)
+{
+	return NS_DETAIL::serialize_stream_impl(std::views::all(std::forward<Range>(range)), chunk_size);
+}
+
+NAMESPACE_END(NS_REFLECT)
+
+#endif //! __SIMPLE_REFLECT_STREAM_HEADER__
@@ -0,0 +1,202 @@
+#ifndef __SIMPLE_REFLECT_TYPE_MAP_HEADER__
+#define __SIMPLE_REFLECT_TYPE_MAP_HEADER__
+
+#include <vector>
+#include <utility>
+#include <concepts>
+
+#include "Defines.hpp"
+
+NAMESPACE_BEGIN(NS_REFLECT)
+
+// A flat open addressing hash table keyed by type_id_v, with linear probing.
+// Since keys are already hashes, no hashing is done on lookup.
+// Intended to replace std::unordered_map<std::type_index, V>.
+template<std::default_initializable V>
+class type_map
+{
+public:
+	using key_type    = std::uint64_t;
+	using mapped_type = V;
+	using size_type   = std::size_t;
+
+	type_map() = default;
+
+	explicit type_map(size_type count)
+	{ reserve(count); }
+
+	template<typename T>
+	V* find() noexcept
+	{ return find(type_id_v<T>); }
+
+	template<typename T>
+	const V* find() const noexcept
+	{ return find(type_id_v<T>); }
+
+	V* find(key_type id) noexcept
+	{
+		const auto idx = find_index(id);
+		return idx == npos ? nullptr : &values[idx];
+	}
+
+	const V* find(key_type id) const noexcept
+	{
+		const auto idx = find_index(id);
+		return idx == npos ? nullptr : &values[idx];
+	}
+
+	template<typename T>
+	bool contains() const noexcept
+	{ return find_index(type_id_v<T>) != npos; }
+
+	bool contains(key_type id) const noexcept
+	{ return find_index(id) != npos; }
+
+	// Insert value for T if not exists, returns the stored value and whether it was inserted.
+	template<typename T, typename ...Args>
+	std::pair<V*, bool> emplace(Args&& ...args)
+	{ return emplace(type_id_v<T>, std::forward<Args>(args)...); }
+
+	template<typename ...Args>
+	std::pair<V*, bool> emplace(key_type id, Args&& ...args)
+	{
+		if ((count + 1) * 2 > keys.size())
+			rehash(keys.empty() ? 16 : keys.size() * 2);
+
+		auto idx = slot_of(id);
+		for (; keys[idx] != empty_key; idx = (idx + 1) & mask())
+		{
+			if (keys[idx] == id)
+				return { &values[idx], false };
+		}
+		keys[idx]   = id;
+		values[idx] = V(std::forward<Args>(args)...);
+		++count;
+		return { &values[idx], true };
+	}
+
+	// Insert or assign value for T.
+	template<typename T, typename U>
+	V& insert_or_assign(U&& value)
+	{ return insert_or_assign(type_id_v<T>, std::forward<U>(value)); }
+
+	template<typename U>
+	V& insert_or_assign(key_type id, U&& value)
+	{
+		auto [ ptr, inserted ] = emplace(id);
+		*ptr = std::forward<U>(value);
+		return *ptr;
+	}
+
+	template<typename T>
+	V& get()
+	{ return *emplace(type_id_v<T>).first; }
+
+	template<typename T>
+	bool erase() noexcept
+	{ return erase(type_id_v<T>); }
+
+	// Backward shift deletion, no tombstones are left.
+	bool erase(key_type id) noexcept
+	{
+		auto idx = find_index(id);
+		if (idx == npos)
+			return false;
+
+		for (auto next = (idx + 1) & mask(); keys[next] != empty_key; next = (next + 1) & mask())
+		{
+			// distance from home slot, an element can only be moved backward
+			// if the hole lies between its home slot and itself
+			const auto home = slot_of(keys[next]);
+			if (((next - home) & mask()) >= ((next - idx) & mask()))
+			{
+				keys[idx]   = keys[next];
+				values[idx] = std::move(values[next]);
+				idx = next;
+			}
+		}
+		keys[idx]   = empty_key;
+		values[idx] = V{};
+		--count;
+		return true;
+	}
+
+	void reserve(size_type n)
+	{
+		size_type capacity = 16;
+		while (capacity < n * 2)
+			capacity *= 2;
+		if (capacity > keys.size())
+			rehash(capacity);
+	}
+
+	void clear() noexcept
+	{
+		keys.assign(keys.size(), empty_key);
+		values.assign(values.size(), V{});
+		count = 0;
+	}
+
+	size_type size()  const noexcept { return count; }
+	bool      empty() const noexcept { return count == 0; }
+
+	// Call func(id, value) for each stored element, in unspecified order.
+	template<typename Func>
+	void for_each(Func&& func)
+	{
+		for (size_type i = 0; i < keys.size(); ++i) {
+			if (keys[i] != empty_key)
+				func(keys[i], values[i]);
+		}
+	}
+
+private:
+	// type_id_v never yields 0
+	inline static constexpr const key_type  empty_key = 0;
+	inline static constexpr const size_type npos = (size_type)-1;
+
+	size_type mask() const noexcept
+	{ return keys.size() - 1; }
+
+	size_type slot_of(key_type id) const noexcept
+	{ return static_cast<size_type>(id ^ (id >> 32)) & mask(); }
+
+	size_type find_index(key_type id) const noexcept
+	{
+		if (keys.empty())
+			return npos;
+		for (auto idx = slot_of(id); keys[idx] != empty_key; idx = (idx + 1) & mask())
+		{
+			if (keys[idx] == id)
+				return idx;
+		}
+		return npos;
+	}
+
+	void rehash(size_type capacity)
+	{
+		std::vector<key_type> old_keys(capacity, empty_key);
+		std::vector<V> old_values(capacity);
+		old_keys.swap(keys);
+		old_values.swap(values);
+
+		for (size_type i = 0; i < old_keys.size(); ++i)
+		{
+			if (old_keys[i] == empty_key)
+				continue;
+			auto idx = slot_of(old_keys[i]);
+			while (keys[idx] != empty_key)
+				idx = (idx + 1) & mask();
+			keys[idx]   = old_keys[i];
+			values[idx] = std::move(old_values[i]);
+		}
+	}
+
+	std::vector<key_type> keys;
+	std::vector<V> values;
+	size_type count = 0;
+};
+
+NAMESPACE_END(NS_REFLECT)
+
+#endif //! __SIMPLE_REFLECT_TYPE_MAP_HEADER__